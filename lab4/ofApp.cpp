@@ -53,6 +53,16 @@ void ofApp::setup(){
 	emitter1.setOneShot(true);
 	emitter1.setEmitterType(RadialEmitter);
 	emitter1.setGroupSize(3000);
+	emitter1.sys->sparkle = true;
+	emitter1.sys->jobs = &jobs;
+	emitter1.setSeed(1);
+
+	// every particle of a burst has the same lifespan, so bursts expire
+	// oldest first and the system can drop them from the front.  Moving
+	// the lifespan slider while a burst is alive switches back to the
+	// compacting scan until it has gone (ParticleEmitter::setLifespan()).
+	//
+	emitter1.setFifo(true);
 	
 
 	tForce2 = new TurbulenceForce(ofVec3f(turbMin->x, turbMin->y, turbMin->z), ofVec3f(turbMax->x, turbMax->y, turbMax->z));
@@ -70,19 +80,46 @@ void ofApp::setup(){
 	emitter2.setOneShot(true);
 	emitter2.setEmitterType(RadialEmitter);
 	emitter2.setGroupSize(1000);
+	emitter2.sys->sparkle = true;
+	emitter2.sys->jobs = &jobs;
+	emitter2.setSeed(2);
+	emitter2.setFifo(true);
 	
 
+	// stress test burst, no forces so the cost is all spawn and cull.
+	// Not FIFO, so 'b' times the compacting expiry pass.
+	//
+	stressEmitter.setVelocity(ofVec3f(0, 5, 0));
+	stressEmitter.setOneShot(true);
+	stressEmitter.setEmitterType(RadialEmitter);
+	stressEmitter.setGroupSize(10000);
+	stressEmitter.sys->sparkle = true;
+	stressEmitter.sys->jobs = &jobs;
+	stressEmitter.setSeed(3);
+	stressEmitter.setLifespan(1);
+	stressEmitter.setParticleRadius(.01);
+	stressEmitter.visible = false;
 }
 
 //--------------------------------------------------------------
 //
 void ofApp::update() {
-	ofSeedRandom();
 
+	// run the simulation in fixed steps, however long the last frame
+	// actually took
+	//
+	int steps = clock.advance(ofGetLastFrameTime());
+	for (int i = 0; i < steps; i++) {
+		step(simClock.tick(clock.dt));
+	}
+}
+
+//  Advance both emitters (and the stress burst) by one fixed step
+//
+void ofApp::step(const SimTime &t) {
 	emitter1.setLifespan(lifespan);
 	emitter1.setRate(rate);
 	emitter1.setParticleRadius(radius);
-	emitter1.update();
 
 	emitter2.setLifespan(lifespan);
 	emitter2.setRate(rate);
@@ -91,8 +128,30 @@ void ofApp::update() {
 	tForce2->set(ofVec3f(turbMin->x, turbMin->y, turbMin->z), ofVec3f(turbMax->x, turbMax->y, turbMax->z));
 	rForce2->setHeight(height);
 	cForce2->setMagnitude(cyclic);
-	emitter2.update();
-	
+
+	// the two emitters share nothing (each has its own random stream),
+	// so update them side by side
+	//
+	vector<JobSystem::Job> updates;
+	updates.push_back([this, &t]() { emitter1.update(t); });
+	updates.push_back([this, &t]() { emitter2.update(t); });
+	jobs.run(updates);
+
+	// time the stress burst and report the step it all expires on
+	//
+	if (bStress) {
+		uint64_t start = ofGetElapsedTimeMicros();
+		stressEmitter.update(t);
+		stressUpdateTime = ofGetElapsedTimeMicros() - start;
+
+		int count = stressEmitter.sys->size();
+		if (stressCount > 0 && count == 0) {
+			stressCullTime = stressUpdateTime;
+			bStress = false;
+			ofLogNotice("stress test: " + std::to_string(stressCount) + " particles culled in " + std::to_string(stressCullTime) + " usec");
+		}
+		stressCount = count;
+	}
 }
 
 //--------------------------------------------------------------
@@ -119,6 +178,7 @@ void ofApp::draw(){
 	//
 	emitter1.draw();
 	emitter2.draw();
+	stressEmitter.draw();
 
 	//  end drawing in the camera
 	// 
@@ -130,6 +190,13 @@ void ofApp::draw(){
 	str += "Frame Rate: " + std::to_string(ofGetFrameRate());
 	ofSetColor(ofColor::white);
 	ofDrawBitmapString(str, ofGetWindowWidth() -170, 15);
+
+	if (bStress || stressCullTime > 0) {
+		string stress;
+		stress += "Stress update (usec): " + std::to_string(stressUpdateTime);
+		stress += "\nStress cull (usec): " + std::to_string(stressCullTime);
+		ofDrawBitmapString(stress, ofGetWindowWidth() - 300, 35);
+	}
 }
 
 
@@ -143,7 +210,12 @@ void ofApp::keyPressed(int key){
 		else cam.enableMouseInput();
 		break;
 	case 'F':
+		break;
 	case 'b':
+		stressCount = 0;
+		stressCullTime = 0;
+		stressEmitter.start();
+		bStress = true;
 		break;
 	case 'f':
 		ofToggleFullscreen();
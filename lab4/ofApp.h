@@ -4,6 +4,7 @@
 #include "ofxGui.h"
 #include "Particle.h"
 #include "ParticleEmitter.h"
+#include "FixedStep.h"
 
 
 
@@ -12,6 +13,7 @@ class ofApp : public ofBaseApp{
 	public:
 		void setup();
 		void update();
+		void step(const SimTime &t);
 		void draw();
 
 		void keyPressed(int key);
@@ -29,6 +31,9 @@ class ofApp : public ofBaseApp{
 		ofEasyCam    cam;
 		ParticleEmitter emitter1;
 		ParticleEmitter emitter2;
+		FixedStep clock;    // 60 fixed steps per second, whatever the frame rate
+		SimClock simClock = SimClock(true);    // time handed to each step, shared by every emitter
+		JobSystem jobs;     // splits each particle update across cores
 
 		// adding forces
 		//
@@ -64,4 +69,13 @@ class ofApp : public ofBaseApp{
 
 
 		ofxPanel gui;
+
+		// stress test - a one-shot burst of 10k particles that all
+		// expire on the same frame ('b' to fire)
+		//
+		ParticleEmitter stressEmitter;
+		bool bStress = false;
+		int stressCount = 0;          // particles alive last frame
+		float stressUpdateTime = 0;   // usec, last frame
+		float stressCullTime = 0;     // usec, frame the burst expired
 };
@@ -10,43 +10,6 @@
 
 #include "ofApp.h"
 
-void TriangleShape::draw() {
-
-
-	if (bSelected)
-		ofSetColor(ofColor::white);
-	else
-		ofSetColor(color);
-
-
-	// tell OpenGL to transform all points using the "current transformation matrix" (CTM);
-	//
-	ofPushMatrix();
-	ofMultMatrix(getMatrix());   // get the current transform for the object.
-
-	// now everything I draw will be transformed by the matrix "T"
-	ofDrawTriangle(verts[0], verts[1], verts[2]);
-
-	ofPopMatrix();
-
-
-}
-
-
-// inside() test method - check to see if point p is inside triangle.
-// how could you improve the design of this method ?
-//
-bool TriangleShape::inside(glm::vec3 p) {
-	glm::vec3 v1 = glm::normalize(verts[0] - p);
-	glm::vec3 v2 = glm::normalize(verts[1] - p);
-	glm::vec3 v3 = glm::normalize(verts[2] - p);
-	float a1 = glm::orientedAngle(v1, v2, glm::vec3(0, 0, 1));
-	float a2 = glm::orientedAngle(v2, v3, glm::vec3(0, 0, 1));
-	float a3 = glm::orientedAngle(v3, v1, glm::vec3(0, 0, 1));
-	if (a1 < 0 && a2 < 0 && a3 < 0) return true;
-	else return false;
-}
-
 void ImageShape::draw() {
 
 
@@ -61,45 +24,6 @@ void ImageShape::draw() {
 }
 
 
-void TriShip::setColor(ofColor color) {
-	this->color = color;
-}
-
-// Integrator for simple trajectory physics
-//
-void TriShip::integrate() {
-
-	// interval for this step 
-	//
-	float dt = 1.0 / 60.0;
-
-	// update position based on velocity
-	//
-	pos += (velocity * dt);
-	rotation += angularVelocity * dt;
-
-	// update acceleration with accumulated paritcles forces
-	// remember :  (f = ma) OR (a = 1/m * f)
-	//
-	ofVec3f accel = acceleration;    // start with any acceleration already on the particle
-
-	accel += (forces * (1.0 / mass));
-	cout << "integrate() = " << forces << endl;
-	velocity += accel * dt;
-
-	cout << "integrate() velocity = " << velocity << endl;
-
-	// add a little damping for good measure
-	//
-	velocity *= damping;
-	angularVelocity *= damping;
-
-	// clear forces on particle (they get re-added each step)
-	//
-	forces.set(0, 0, 0);
-}
-
-
 //--------------------------------------------------------------
 ThrustForce::ThrustForce(float magnitude) {
 	this->magnitude = magnitude;
@@ -128,25 +52,25 @@ void ThrustForce::set(float magnitude) {
 }
 
 
-void ofApp::attack() {
+void ofApp::attack(float dt) {
 	for (int i = 0; i < attackers.size(); i++) {
 		ofVec3f distance = tri.pos - attackers[i].pos;
 		if (distance.length() <= distThreshold) {
 			attackers[i].rotation = glm::degrees(atan2(distance.x, distance.y));
 			attackers[i].velocity += distance;
-			attackers[i].integrate();
+			attackers[i].integrate(dt);
 		}
 	}
 }
 
 
-void ofApp::run() {
+void ofApp::run(float dt) {
 	for (int i = 0; i < runners.size(); i++) {
 		ofVec3f distance = tri.pos - runners[i].pos;
 		if (distance.length() <= distThreshold) { 
 			runners[i].rotation = tri.rotation;
 			runners[i].velocity -= 15 * heading();
-			runners[i].integrate();
+			runners[i].integrate(dt);
 		}
 	}
 }
@@ -230,9 +154,13 @@ void ofApp::update() {
 		//thrustForce->set(thrustSlider);
 		//thrustForce->updateForce(&tri);
 
-		tri.integrate();
-		run();
-		attack();
+		// step by the real frame time so motion and damping don't
+		// depend on the frame rate
+		//
+		float dt = ofGetLastFrameTime();
+		tri.integrate(dt);
+		run(dt);
+		attack(dt);
 
 		
 
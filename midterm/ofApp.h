@@ -10,37 +10,10 @@
 
 #include "ofMain.h"
 #include "ofxGui.h"
+#include "Shape.h"
 
 
 
-//  Shape base class
-//
-class Shape {
-public:
-	Shape() {}
-	virtual void draw() {}
-	virtual bool inside() { return false; }
-
-	glm::vec3 pos;
-	float rotation = 0.0;
-	glm::vec3 scale = glm::vec3(1.0, 1.0, 1.0);
-
-	// get transformation matrix for object (based on it's current pos, rotation and scale channels)
-	//
-	glm::mat4 getMatrix() {
-		glm::mat4 trans = glm::translate(glm::mat4(1.0), glm::vec3(pos));
-		glm::mat4 rot = glm::rotate(glm::mat4(1.0), glm::radians(rotation), glm::vec3(0, 0, 1));
-		glm::mat4 scale = glm::scale(glm::mat4(1.0), this->scale);
-
-		return (trans * rot * scale);
-	}
-
-	vector<glm::vec3> verts;
-	bool bSelected = false;
-	ofColor color = ofColor::yellow;
-
-};
-
 //  Imnage Class Example (that uses Shape transformations) (not used for midterm)
 //
 class ImageShape : public Shape {
@@ -61,55 +34,6 @@ public:
 	ofImage image;
 };
 
-//  TriangleShape Example (that uses Shape Transformations)
-//
-class TriangleShape : public Shape {
-public:
-	TriangleShape() {}
-	TriangleShape(glm::vec3 p1, glm::vec3 p2, glm::vec3 p3) {
-		verts.push_back(p1);
-		verts.push_back(p2);
-		verts.push_back(p3);
-	}
-	bool inside(glm::vec3 p);
-
-	void draw();
-
-};
-
-//  The Triangle Space Ship
-//
-class TriShip : public TriangleShape {
-public:
-	TriShip(glm::vec3 p1 = glm::vec3(-10, -10, 0),
-		glm::vec3 p2 = glm::vec3(0, 20, 0),
-		glm::vec3 p3 = glm::vec3(10, -10, 0),
-		ofColor color = ofColor::yellow) {
-		verts.push_back(p1);
-		verts.push_back(p2);
-		verts.push_back(p3);
-		this->color = color;
-	}
-
-	void setColor(ofColor);
-
-	//  Integrator Function;
-	//
-	void integrate();
-
-	// Physics data goes here  (for integrate() );
-	//
-	ofVec3f velocity = ofVec3f(0, 0, 0); 
-	float angularVelocity = 0;
-	ofVec3f acceleration;
-	ofVec3f forces;
-	float damping = 0.99;
-	float mass = 1.0;
-	
-
-};
-
-
 // Pure virtual Function Class - must be subclassed to create new forces
 class Force {
 protected:
@@ -192,6 +116,6 @@ public:
 	void resetScreen();
 	void addAttacker();
 	void addRunner();
-	void attack();
-	void run();
+	void attack(float dt);
+	void run(float dt);
 };
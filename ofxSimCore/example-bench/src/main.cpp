@@ -0,0 +1,13 @@
+#include "ofMain.h"
+#include "ofAppNoWindow.h"
+#include "ofApp.h"
+
+//========================================================================
+int main( ){
+	// no window and no GL context, the benchmark only steps the simulation
+	//
+	ofSetupOpenGL(make_shared<ofAppNoWindow>(), 1024, 768, OF_WINDOW);
+
+	ofRunApp(new ofApp());
+
+}
@@ -0,0 +1,676 @@
+#include "ofApp.h"
+#include <chrono>
+
+typedef std::chrono::steady_clock BenchClock;
+
+static double elapsedNs(BenchClock::time_point start) {
+	return std::chrono::duration<double, std::nano>(BenchClock::now() - start).count();
+}
+
+//--------------------------------------------------------------
+void ofApp::setup() {
+	cout << "ofxSimCore bench, " << frames << " frames at dt = " << dt << endl;
+
+	benchBurst();
+	benchExpiry();
+	benchRepeatedBursts();
+	benchSpawn(RadialEmitter, "spawn radial");
+	benchSpawn(SphereEmitter, "spawn sphere");
+	benchSpawn(DiscEmitter, "spawn disc");
+	benchSpawn(ConeEmitter, "spawn cone");
+	benchStream(false);
+	benchStream(true);
+	benchThreads();
+	benchStatic();
+	benchIntegrators();
+	benchMesh();
+	benchQueries();
+	benchSprites();
+	benchShoot();
+	benchCull(false);
+	benchCull(true);
+	benchSpatialHash();
+
+	ofExit();
+}
+
+void ofApp::report(const string &name, double ns, int frames, int count, const string &unit) {
+	double perFrame = ns / frames;
+	cout << name << ": " << count << " " << unit << "s, "
+		<< perFrame / 1000.0 << " us/frame, "
+		<< perFrame / max(count, 1) << " ns/" << unit << endl;
+}
+
+//  The lab4 burst: 3000 particles from one radial one-shot emitter under
+//  turbulence, gravity, a radial impulse and a cyclic force.
+//
+void ofApp::benchBurst() {
+	ParticleEmitter emitter;
+	emitter.setSeed(134);
+	TurbulenceForce turbulence(ofVec3f(-20, -20, -20), ofVec3f(20, 20, 20));
+	GravityForce gravity(ofVec3f(0, -10, 0));
+	ImpulseRadialForce radial(300, 1);
+	CyclicForce cyclic(10);
+	emitter.sys->addForce(&turbulence);
+	emitter.sys->addForce(&gravity);
+	emitter.sys->addForce(&radial);
+	emitter.sys->addForce(&cyclic);
+
+	// long life so the count holds steady for the whole run
+	//
+	emitter.setVelocity(ofVec3f(0, 0, 0));
+	emitter.setOneShot(true);
+	emitter.setEmitterType(RadialEmitter);
+	emitter.setGroupSize(3000);
+	emitter.setLifespan(1000);
+	SimClock clock(true);
+	emitter.start();
+	emitter.update(clock.tick(dt));
+
+	int count = emitter.sys->size();
+	BenchClock::time_point start = BenchClock::now();
+	for (int i = 0; i < frames; i++) {
+		emitter.update(clock.tick(dt));
+	}
+	report("burst", elapsedNs(start), frames, count, "particle");
+}
+
+//  Just the spawn: a 3000 particle group every frame into an emptied
+//  system.  The mean of the direction's z should be near 0 and its mean
+//  absolute value near 0.5 for directions uniform over the sphere (the
+//  cone covers less of it, so more).
+//
+void ofApp::benchSpawn(EmitterType type, const string &name) {
+	ParticleEmitter emitter;
+	emitter.setSeed(134);
+	emitter.setEmitterType(type);
+	emitter.setVelocity(ofVec3f(0, 0, 10));
+	emitter.setRadius(5);
+	int count = 3000;
+
+	BenchClock::time_point start = BenchClock::now();
+	for (int i = 0; i < frames; i++) {
+		emitter.sys->particles.clear();
+		emitter.spawnGroup(count, 0);
+	}
+	report(name, elapsedNs(start), frames, count, "particle");
+
+	double z = 0, absz = 0;
+	for (int i = 0; i < count; i++) {
+		float dz = emitter.sys->particles.velocity[i].getNormalized().z;
+		z += dz;
+		absz += fabs(dz);
+	}
+	cout << name << ": mean z " << z / count << ", mean |z| " << absz / count << endl;
+}
+
+//  A steady stream with one lifespan: 50 particles 60 times a second for
+//  2 seconds, no forces, so the cost is spawn, expiry and integration.
+//  Counts how often the arrays had to grow.
+//
+void ofApp::benchStream(bool fifo) {
+	ParticleEmitter emitter;
+	emitter.setSeed(134);
+	emitter.setEmitterType(RadialEmitter);
+	emitter.setRate(60);
+	emitter.setGroupSize(50);
+	emitter.setLifespan(2);
+	emitter.setFifo(fifo);
+	emitter.start();
+
+	SimClock clock(true);
+	long updates = 0;
+	int grows = 0;
+	size_t capacity = emitter.sys->particles.position.capacity();
+	BenchClock::time_point start = BenchClock::now();
+	for (int i = 0; i < frames; i++) {
+		emitter.update(clock.tick(dt));
+		updates += emitter.sys->size();
+		if (emitter.sys->particles.position.capacity() != capacity) {
+			capacity = emitter.sys->particles.position.capacity();
+			grows++;
+		}
+	}
+	string name = fifo ? "stream fifo" : "stream";
+	report(name, elapsedNs(start), frames, updates / frames, "particle");
+	cout << name << ": " << emitter.sys->size() << " alive at the end, arrays grew " << grows << " times" << endl;
+}
+
+//  lab4's 'b' stress test: a one-shot 10000 particle burst with a 1 sec
+//  lifespan and no forces, not FIFO, so every particle dies on the same
+//  step and the compacting expiry pass removes them all at once.  Reports
+//  that step against the mean of the steps before it.
+//
+void ofApp::benchExpiry() {
+	const int count = 10000;
+	ParticleEmitter emitter;
+	emitter.setSeed(3);
+	emitter.setVelocity(ofVec3f(0, 5, 0));
+	emitter.setOneShot(true);
+	emitter.setEmitterType(RadialEmitter);
+	emitter.setGroupSize(count);
+	emitter.setLifespan(1);
+
+	SimClock clock(true);
+	emitter.start();
+	emitter.update(clock.tick(dt));
+
+	int steps = 0;
+	double liveNs = 0, expiryNs = 0;
+	while (emitter.sys->size() > 0 && steps < frames) {
+		BenchClock::time_point start = BenchClock::now();
+		emitter.update(clock.tick(dt));
+		double ns = elapsedNs(start);
+		if (emitter.sys->size() > 0) {
+			liveNs += ns;
+			steps++;
+		}
+		else expiryNs = ns;
+	}
+	report("expiry live", liveNs, max(steps, 1), count, "particle");
+	report("expiry step", expiryNs, 1, count, "particle");
+	cout << "expiry: " << count << " particles, " << emitter.sys->size() << " left after " << steps + 1 << " steps" << endl;
+}
+
+//  Fire a new 1000 particle burst every 60 frames on top of the ones
+//  still alive, so spawning and the growing store are in the measurement.
+//
+void ofApp::benchRepeatedBursts() {
+	ParticleEmitter emitter;
+	emitter.setSeed(134);
+	GravityForce gravity(ofVec3f(0, -10, 0));
+	ImpulseRadialForce radial(300, 1);
+	emitter.sys->addForce(&gravity);
+	emitter.sys->addForce(&radial);
+
+	emitter.setOneShot(true);
+	emitter.setEmitterType(RadialEmitter);
+	emitter.setGroupSize(1000);
+	emitter.setLifespan(1000);
+
+	SimClock clock(true);
+	long updates = 0;
+	BenchClock::time_point start = BenchClock::now();
+	for (int i = 0; i < frames; i++) {
+		if (i % 60 == 0) {
+			emitter.sys->reset();
+			emitter.start();
+		}
+		emitter.update(clock.tick(dt));
+		updates += emitter.sys->size();
+	}
+	double ns = elapsedNs(start);
+	report("bursts", ns, frames, updates / frames, "particle");
+}
+
+//  lab4's two emitters, 3000 and 1000 particles with their forces
+//
+class Lab4Scene {
+public:
+	Lab4Scene() :
+		turbulence1(ofVec3f(-20, -20, -20), ofVec3f(20, 20, 20)), gravity1(ofVec3f(0, -10, 0)), radial1(300, 1),
+		turbulence2(ofVec3f(-20, -20, -20), ofVec3f(20, 20, 20)), gravity2(ofVec3f(0, -10, 0)), radial2(1000, 1), cyclic2(10) {
+		radial2.setHeight(0.02);
+		setup(emitter1, 3000);
+		emitter1.setSeed(1);
+		emitter1.sys->addForce(&turbulence1);
+		emitter1.sys->addForce(&gravity1);
+		emitter1.sys->addForce(&radial1);
+		setup(emitter2, 1000);
+		emitter2.setSeed(2);
+		emitter2.sys->addForce(&turbulence2);
+		emitter2.sys->addForce(&gravity2);
+		emitter2.sys->addForce(&radial2);
+		emitter2.sys->addForce(&cyclic2);
+	}
+	void setup(ParticleEmitter &e, int n) {
+		e.setVelocity(ofVec3f(0, 0, 0));
+		e.setOneShot(true);
+		e.setEmitterType(RadialEmitter);
+		e.setGroupSize(n);
+		e.setLifespan(1000);
+	}
+
+	ParticleEmitter emitter1, emitter2;
+
+	// emitter1's forces, then emitter2's
+	//
+	TurbulenceForce turbulence1;
+	GravityForce gravity1;
+	ImpulseRadialForce radial1;
+	TurbulenceForce turbulence2;
+	GravityForce gravity2;
+	ImpulseRadialForce radial2;
+	CyclicForce cyclic2;
+};
+
+//  lab4's second emitter (turbulence, gravity, radial impulse and cyclic
+//  force) on 4000 particles, once with the forces in the usual vector of
+//  pointers and once as a StaticParticleSystem.  Both draw the same random
+//  numbers but in a different order, so the clouds should match in size
+//  rather than particle for particle.
+//
+void ofApp::benchStatic() {
+	TurbulenceForce turbulence(ofVec3f(-20, -20, -20), ofVec3f(20, 20, 20));
+	GravityForce gravity(ofVec3f(0, -10, 0));
+	ImpulseRadialForce radial(1000, 1);
+	CyclicForce cyclic(10);
+	radial.setHeight(0.02);
+
+	ParticleSystem dynamicSys;
+	dynamicSys.addForce(&turbulence);
+	dynamicSys.addForce(&gravity);
+	dynamicSys.addForce(&radial);
+	dynamicSys.addForce(&cyclic);
+	StaticParticleSystem<TurbulenceForce, GravityForce, ImpulseRadialForce, CyclicForce> staticSys(turbulence, gravity, radial, cyclic);
+
+	ParticleSystem *systems[2] = { &dynamicSys, &staticSys };
+	const char *names[2] = { "forces dynamic", "forces static" };
+	for (int s = 0; s < 2; s++) {
+		ParticleEmitter emitter(systems[s]);
+		emitter.setSeed(2);
+		emitter.setVelocity(ofVec3f(0, 0, 0));
+		emitter.setOneShot(true);
+		emitter.setEmitterType(RadialEmitter);
+		emitter.setGroupSize(4000);
+		emitter.setLifespan(1000);
+
+		SimClock clock(true);
+		emitter.start();
+		emitter.update(clock.tick(dt));
+
+		int count = systems[s]->size();
+		BenchClock::time_point start = BenchClock::now();
+		for (int i = 0; i < frames; i++) {
+			emitter.update(clock.tick(dt));
+		}
+		report(names[s], elapsedNs(start), frames, count, "particle");
+
+		double spread = 0;
+		for (int i = 0; i < count; i++) spread += systems[s]->particles.position[i].length();
+		cout << names[s] << ": mean distance " << spread / count << endl;
+	}
+}
+
+//  A spring to the origin, f = -k x.  With no damping the energy
+//  1/2 m v^2 + 1/2 k x^2 should stay put, so how far it moves in a run is
+//  the integrator's error.
+//
+class SpringForce : public ParticleForce {
+public:
+	SpringForce(float k) : k(k) {}
+	void updateForce(Particle *p) { p->forces += at(p->position); }
+	void applyBatch(const ParticleBatch &b) {
+		for (int i = 0; i < b.count; i++) b.forces[i] += at(b.position[i]);
+	}
+	bool threadSafe() const { return true; }
+	ofVec3f at(const ofVec3f &x) const { return -k * x; }
+	ofVec3f at(const ParticleBatch &b, int i) const { return at(b.position[i]); }
+	float energy(const ofVec3f &x, const ofVec3f &v, float m) const { return 0.5f * m * v.lengthSquared() + 0.5f * k * x.lengthSquared(); }
+	float k;
+};
+
+//  Each integrator on 4000 undamped particles on springs (period about
+//  3 sec), for the cost per particle per step and the energy drift over
+//  the run.  Then the same spring on a single object for each kind of
+//  entity: an Emitter, a TriShip and a Particle hold the force over the
+//  step, "body" calls integrateStep() with the spring itself.
+//
+void ofApp::benchIntegrators() {
+	SpringForce spring(4);
+	const int count = 4000;
+	ofVec3f start0(0, 50, 0);
+
+	for (int type = ExplicitEuler; type <= RK4; type++) {
+		IntegratorType integrator = (IntegratorType)type;
+		string name = string("integrate ") + integratorName(integrator);
+
+		ParticleSystem sys;
+		sys.addForce(&spring);
+		sys.integrator = integrator;
+		Random rng(3);
+		int first = sys.addGroup(count);
+		double e0 = 0;
+		for (int i = first; i < first + count; i++) {
+			sys.particles.position[i] = ofVec3f(rng.random(-100, 100), rng.random(-100, 100), rng.random(-100, 100));
+			sys.particles.mass[i] = rng.random(0.5, 2);
+			sys.particles.damping[i] = 1;
+			sys.particles.lifespan[i] = -1;
+			e0 += spring.energy(sys.particles.position[i], sys.particles.velocity[i], sys.particles.mass[i]);
+		}
+
+		SimClock clock(true);
+		BenchClock::time_point start = BenchClock::now();
+		for (int i = 0; i < frames; i++) {
+			sys.update(clock.tick(dt));
+		}
+		report(name, elapsedNs(start), frames, count, "particle");
+
+		double e1 = 0;
+		for (int i = sys.particles.begin(); i < sys.particles.end(); i++)
+			e1 += spring.energy(sys.particles.position[i], sys.particles.velocity[i], sys.particles.mass[i]);
+
+		// the same spring on one object of each kind
+		//
+		SpriteSystem sprites;
+		Emitter emitter(&sprites);
+		emitter.integrator = integrator;
+		emitter.damping = 1;
+		emitter.pos = start0;
+		emitter.velocity = ofVec3f(0, 0, 0);
+
+		TriShip ship;
+		ship.integrator = integrator;
+		ship.damping = 1;
+		ship.pos = start0;
+
+		ParticleStore store;
+		Particle particle(store, store.add());
+		particle.damping = 1;
+		particle.position = start0;
+
+		ofVec3f bodyPos = start0, bodyVel;
+		for (int i = 0; i < frames; i++) {
+			emitter.forces = spring.at(emitter.pos);
+			emitter.integrate(dt);
+			ship.forces = spring.at(ship.pos);
+			ship.integrate(dt);
+			particle.forces = spring.at(particle.position);
+			particle.integrate(dt, integrator);
+			integrateStep(integrator, bodyPos, bodyVel, [&](const ofVec3f &x, const ofVec3f &) { return spring.at(x); }, dt);
+		}
+
+		double eStart = spring.energy(start0, ofVec3f(), 1);
+		cout << name << ": energy drift " << 100 * (e1 - e0) / e0 << "%"
+			<< ", emitter " << 100 * (spring.energy(emitter.pos, emitter.velocity, 1) - eStart) / eStart << "%"
+			<< ", triship " << 100 * (spring.energy(ship.pos, ship.velocity, 1) - eStart) / eStart << "%"
+			<< ", particle " << 100 * (spring.energy(particle.position, particle.velocity, 1) - eStart) / eStart << "%"
+			<< ", body " << 100 * (spring.energy(bodyPos, bodyVel, 1) - eStart) / eStart << "%" << endl;
+	}
+}
+
+//  ParticleSystem::buildMesh() for 10000 known particles, no GL needed.
+//  Checks the buffer sizes (4 vertices, 4 colors and 6 indices per
+//  particle) and one quad's corners and indices against its position,
+//  radius and the right/up axes.
+//
+void ofApp::benchMesh() {
+	const int count = 10000;
+	ParticleSystem sys;
+	int first = sys.addGroup(count);
+	for (int i = first; i < first + count; i++) {
+		sys.particles.position[i] = ofVec3f(i, 2 * i, -i);
+		sys.particles.radius[i] = 0.5 + (i % 4) * 0.25;
+		sys.particles.color[i] = ofColor(i % 256, 0, 255);
+	}
+	glm::vec3 right = glm::normalize(glm::vec3(1, 1, 0));
+	glm::vec3 up = glm::vec3(0, 0, 1);
+
+	ofMesh mesh;
+	BenchClock::time_point start = BenchClock::now();
+	for (int i = 0; i < frames; i++) {
+		sys.buildMesh(mesh, right, up);
+	}
+	report("mesh", elapsedNs(start), frames, count, "particle");
+
+	const vector<glm::vec3> &verts = mesh.getVertices();
+	const vector<ofFloatColor> &colors = mesh.getColors();
+	const vector<ofIndexType> &indices = mesh.getIndices();
+	bool sizes = verts.size() == 4 * count && colors.size() == 4 * count && indices.size() == 6 * count;
+
+	// quad k is particle first + k: corners counter clockwise from
+	// -right -up, and two triangles 0 1 2, 0 2 3
+	//
+	int k = 7;
+	int i = first + k;
+	glm::vec3 c = sys.particles.position[i];
+	glm::vec3 dx = right * sys.particles.radius[i];
+	glm::vec3 dy = up * sys.particles.radius[i];
+	glm::vec3 corners[4] = { c - dx - dy, c + dx - dy, c + dx + dy, c - dx + dy };
+	int order[6] = { 0, 1, 2, 0, 2, 3 };
+	bool quad = sizes;
+	for (int j = 0; j < 4 && quad; j++) {
+		quad = glm::length(verts[4 * k + j] - corners[j]) < 1e-4 && colors[4 * k + j].r == ofFloatColor(sys.particles.color[i]).r;
+	}
+	for (int j = 0; j < 6 && quad; j++) {
+		quad = indices[6 * k + j] == (ofIndexType)(4 * k + order[j]);
+	}
+	cout << "mesh: " << verts.size() << " vertices, " << colors.size() << " colors, " << indices.size() << " indices, "
+		<< (sizes && quad ? "quads match" : "MESH WRONG") << endl;
+}
+
+//  Run the lab4 scene once on this thread and once on the JobSystem, with
+//  each system split into chunks and the two systems side by side.  The
+//  particles should end up in exactly the same place.
+//
+void ofApp::benchThreads() {
+	Lab4Scene serial, threaded;
+	threaded.emitter1.sys->jobs = &jobs;
+	threaded.emitter1.sys->chunkSize = 256;
+	threaded.emitter2.sys->jobs = &jobs;
+	threaded.emitter2.sys->chunkSize = 256;
+	serial.emitter1.sys->chunkSize = 256;
+	serial.emitter2.sys->chunkSize = 256;
+
+	// both scenes start from the same seeds
+	//
+	SimClock serialClock(true), threadedClock(true);
+	serial.emitter1.start();
+	serial.emitter2.start();
+	serial.emitter1.update(serialClock.tick(dt));
+	serial.emitter2.update(serialClock.now());
+	threaded.emitter1.start();
+	threaded.emitter2.start();
+	threaded.emitter1.update(threadedClock.tick(dt));
+	threaded.emitter2.update(threadedClock.now());
+
+	int count = serial.emitter1.sys->size() + serial.emitter2.sys->size();
+
+	BenchClock::time_point start = BenchClock::now();
+	for (int i = 0; i < frames; i++) {
+		const SimTime &t = serialClock.tick(dt);
+		serial.emitter1.update(t);
+		serial.emitter2.update(t);
+	}
+	report("lab4 serial", elapsedNs(start), frames, count, "particle");
+
+	vector<JobSystem::Job> updates;
+	start = BenchClock::now();
+	for (int i = 0; i < frames; i++) {
+		const SimTime &t = threadedClock.tick(dt);
+		updates.clear();
+		updates.push_back([&]() { threaded.emitter1.update(t); });
+		updates.push_back([&]() { threaded.emitter2.update(t); });
+		jobs.run(updates);
+	}
+	report("lab4 threaded", elapsedNs(start), frames, count, "particle");
+
+	bool same = serial.emitter1.sys->particles.position == threaded.emitter1.sys->particles.position &&
+		serial.emitter2.sys->particles.position == threaded.emitter2.sys->particles.position;
+	cout << "lab4 threaded: " << jobs.size() << " threads, " << jobs.steals << " steals, "
+		<< (same ? "same result" : "RESULTS DIFFER") << endl;
+}
+
+//  100 radius queries a frame against a moving 3000 particle burst, so
+//  the grid is rebuilt every frame (the cost per query includes the
+//  update).  The answers and removeNear() are checked against a brute
+//  force scan.
+//
+void ofApp::benchQueries() {
+	ParticleEmitter emitter;
+	emitter.setSeed(134);
+	ImpulseRadialForce radial(300, 1);
+	emitter.sys->addForce(&radial);
+	emitter.setOneShot(true);
+	emitter.setEmitterType(RadialEmitter);
+	emitter.setGroupSize(3000);
+	emitter.setLifespan(1000);
+	emitter.sys->setGridCellSize(1);
+
+	SimClock clock(true);
+	emitter.start();
+	for (int i = 0; i < 60; i++) {
+		emitter.update(clock.tick(dt));
+	}
+
+	ParticleSystem *sys = emitter.sys;
+	int queries = 100;
+	float dist = 1;
+	vector<int> found;
+
+	int mismatches = 0;
+	for (int q = 0; q < queries; q++) {
+		glm::vec3 p = sys->particles.position[q * 17 % sys->size()];
+		sys->queryRadius(p, dist, found);
+		int brute = 0;
+		for (int i = 0; i < sys->size(); i++) {
+			if (glm::length((glm::vec3)sys->particles.position[i] - p) < dist) brute++;
+		}
+		if (brute != found.size()) mismatches++;
+	}
+
+	long hits = 0;
+	BenchClock::time_point start = BenchClock::now();
+	for (int i = 0; i < frames; i++) {
+		emitter.update(clock.tick(dt));
+		for (int q = 0; q < queries; q++) {
+			sys->queryRadius(sys->particles.position[q * 17 % sys->size()], dist, found);
+			hits += found.size();
+		}
+	}
+	report("queries", elapsedNs(start), frames, queries, "lookup");
+
+	// removeNear should take out exactly what the scan finds
+	//
+	glm::vec3 p = sys->particles.position[0];
+	int brute = 0;
+	for (int i = 0; i < sys->size(); i++) {
+		if (glm::length((glm::vec3)sys->particles.position[i] - p) < 5 * dist) brute++;
+	}
+	int before = sys->size();
+	int removed = sys->removeNear(p, 5 * dist);
+	if (removed != brute || sys->size() != before - brute) mismatches++;
+
+	cout << "queries: " << hits / (frames * queries) << " found per query, "
+		<< mismatches << " mismatches against brute force" << endl;
+}
+
+//  10000 moving sprites, no images.
+//
+void ofApp::benchSprites() {
+	ofSeedRandom(134);
+
+	SpriteSystem sys;
+	for (int i = 0; i < 10000; i++) {
+		Sprite sprite;
+		sprite.setPosition(glm::vec3(ofRandom(1024), ofRandom(768), 0));
+		sprite.velocity = ofVec3f(ofRandom(-100, 100), ofRandom(-100, 100), 0);
+		sys.add(sprite);
+	}
+
+	SimClock clock(true);
+	int count = sys.sprites.size();
+	BenchClock::time_point start = BenchClock::now();
+	for (int i = 0; i < frames; i++) {
+		sys.update(clock.tick(dt));
+	}
+	report("sprites", elapsedNs(start), frames, count, "sprite");
+}
+
+//  An emitter firing every step with a 2 second lifespan, so sprites
+//  expire as fast as they spawn.  After the first lifespan the pool
+//  should be reusing slots with no allocations.
+//
+void ofApp::benchShoot() {
+	SpriteSystem sys;
+	Emitter gun(&sys);
+	gun.setRate(60);
+	gun.setLifespan(2000);
+	gun.setVelocity(ofVec3f(0, -100, 0));
+	gun.start();
+
+	SimClock clock(true);
+	long updates = 0;
+	int steadyAllocs = 0;
+	int spawned = 0;
+	BenchClock::time_point start = BenchClock::now();
+	for (int i = 0; i < frames; i++) {
+		sys.newFrame();
+		gun.update(clock.tick(dt));
+		updates += sys.sprites.size();
+		spawned += sys.frameSpawns;
+		if (i >= 120) steadyAllocs += sys.frameAllocs;
+	}
+	report("shoot", elapsedNs(start), frames, updates / frames, "sprite");
+	cout << "shoot: " << sys.totalAllocs << " allocs, " << steadyAllocs << " after warm up" << endl;
+	cout << "shoot: " << spawned << " spawned, " << gun.rate * frames * dt << " expected" << endl;
+}
+
+//  project1part2 gun at the bottom of a 1024x768 window with the longest
+//  lifespan on the slider.  Without retirement most of the live shots
+//  are above the window; with it they are dropped as they leave.
+//
+void ofApp::benchCull(bool retire) {
+	SpriteSystem sys;
+	sys.setBounds(ofRectangle(0, 0, 1024, 768));
+	sys.retireOffscreen = retire;
+	Emitter gun(&sys);
+	gun.setPosition(ofVec3f(512, 700, 0));
+	gun.setRate(10);
+	gun.setLifespan(10000);
+	gun.setVelocity(ofVec3f(0, -100, 0));
+	gun.start();
+
+	SimClock clock(true);
+	long updates = 0;
+	long onScreen = 0;
+	int retired = 0;
+	BenchClock::time_point start = BenchClock::now();
+	for (int i = 0; i < frames; i++) {
+		sys.newFrame();
+		gun.update(clock.tick(dt));
+		updates += sys.sprites.size();
+		retired += sys.frameRetired;
+	}
+	double ns = elapsedNs(start);
+
+	for (int i = 0; i < sys.sprites.size(); i++) {
+		if (sys.onScreen(sys.sprites[i], sys.sprites[i].pos)) onScreen++;
+	}
+	string name = retire ? "cull retire" : "cull";
+	report(name, ns, frames, updates / frames, "sprite");
+	cout << name << ": " << onScreen << " of " << sys.sprites.size()
+		<< " on screen at the end, " << retired << " retired" << endl;
+}
+
+//  project1part3 style collisions: 500 missiles against 2000 invaders,
+//  rebuilding the grid every frame.
+//
+void ofApp::benchSpatialHash() {
+	ofSeedRandom(134);
+
+	SpriteSystem missiles, invaders;
+	for (int i = 0; i < 500; i++) {
+		Sprite sprite;
+		sprite.setPosition(glm::vec3(ofRandom(1024), ofRandom(768), 0));
+		missiles.add(sprite);
+	}
+	for (int i = 0; i < 2000; i++) {
+		Sprite sprite;
+		sprite.setPosition(glm::vec3(ofRandom(1024), ofRandom(768), 0));
+		invaders.add(sprite);
+	}
+
+	float collisionDist = 50;
+	SpatialHash grid(collisionDist);
+	vector<SpritePair> hits;
+
+	int count = missiles.sprites.size() + invaders.sprites.size();
+	BenchClock::time_point start = BenchClock::now();
+	for (int i = 0; i < frames; i++) {
+		grid.clear();
+		grid.insert(&invaders);
+		grid.pairs(&missiles, collisionDist, hits);
+	}
+	report("spatial hash", elapsedNs(start), frames, count, "sprite");
+}
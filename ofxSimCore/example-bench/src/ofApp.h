@@ -0,0 +1,38 @@
+#pragma once
+
+#include "ofMain.h"
+#include "ofxSimCore.h"
+
+//  Headless benchmark for ofxSimCore.  setup() runs each canned scenario
+//  for a fixed number of frames on a virtual clock at dt = 1/60, prints
+//  the cost per particle (or sprite) per update and exits.  Nothing is
+//  drawn.
+//
+class ofApp : public ofBaseApp {
+
+public:
+	void setup();
+
+	void benchBurst();
+	void benchExpiry();
+	void benchRepeatedBursts();
+	void benchSpawn(EmitterType type, const string &name);
+	void benchStream(bool fifo);
+	void benchThreads();
+	void benchStatic();
+	void benchIntegrators();
+	void benchMesh();
+	void benchQueries();
+	void benchSprites();
+	void benchShoot();
+	void benchCull(bool retire);
+	void benchSpatialHash();
+
+	// print one result line; ns is the total for all frames
+	//
+	void report(const string &name, double ns, int frames, int count, const string &unit);
+
+	int frames = 600;
+	float dt = 1.0 / 60.0;
+	JobSystem jobs;
+};
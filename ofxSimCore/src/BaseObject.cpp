@@ -0,0 +1,44 @@
+#include "BaseObject.h"
+
+// BaseObject class
+
+BaseObject::BaseObject() {
+	pos = glm::vec3(0, 0, 0);
+	scaleVector = glm::vec3(1, 1, 1);
+	rot = 0;
+	heading = glm::vec3(0, -1, 0);
+	lastPos = pos;
+	lastRot = rot;
+}
+
+void BaseObject::setPosition(glm::vec3 pos) {
+	this->pos = pos;
+	lastPos = pos;
+}
+
+// remember where we are before a simulation step moves us
+//
+void BaseObject::saveState() {
+	lastPos = pos;
+	lastRot = rot;
+}
+
+glm::mat4 BaseObject::getMatrix() {
+	glm::mat4 transMatrix = glm::translate(glm::mat4(1.0), glm::vec3(pos));
+	glm::mat4 rotMatrix = glm::rotate(glm::mat4(1.0), glm::radians(rot), glm::vec3(0, 0, 1));
+	glm::mat4 scaleMatrix = glm::scale(glm::mat4(1.0), glm::vec3(this->scaleVector));
+
+	return (transMatrix * rotMatrix * scaleMatrix);
+}
+
+// matrix for a point "alpha" of the way from the last step to the current one
+//
+glm::mat4 BaseObject::getMatrix(float alpha) {
+	glm::vec3 p = glm::mix(lastPos, pos, alpha);
+	float r = glm::mix(lastRot, rot, alpha);
+	glm::mat4 transMatrix = glm::translate(glm::mat4(1.0), p);
+	glm::mat4 rotMatrix = glm::rotate(glm::mat4(1.0), glm::radians(r), glm::vec3(0, 0, 1));
+	glm::mat4 scaleMatrix = glm::scale(glm::mat4(1.0), glm::vec3(this->scaleVector));
+
+	return (transMatrix * rotMatrix * scaleMatrix);
+}
\ No newline at end of file
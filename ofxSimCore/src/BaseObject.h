@@ -1,6 +1,5 @@
 #pragma once
 #include "ofMain.h"
-#include "ofxGui.h"
 
 typedef enum { MoveStop, MoveLeft, MoveRight, MoveUp, MoveDown, MoveCircle, MoveSine } MoveDir;
 typedef enum { LinearEnemy, CircularEnemy, SineEnemy } EnemyType;
@@ -15,8 +14,15 @@ public:
 	glm::vec3 pos; //added
 	glm::vec3 heading;
 	bool isEnemy = false;
+
+	// state at the start of the last simulation step, for interpolation
+	//
+	glm::vec3 lastPos;
+	float lastRot;
 	
 	void setPosition(glm::vec3);
+	void saveState();
 	glm::mat4 getMatrix();
+	glm::mat4 getMatrix(float alpha);
 };
 
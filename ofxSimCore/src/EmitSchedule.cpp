@@ -0,0 +1,29 @@
+#include "EmitSchedule.h"
+
+int EmitSchedule::advance(float rate, const SimTime &t) {
+	this->rate = rate;
+	time = t.time;
+	count = 0;
+	if (rate <= 0) return 0;
+
+	debt += rate * t.dt;
+	count = (int)debt;
+	debt -= count;
+	return count;
+}
+
+//  The newest spawn was due "debt" spawns ago, and each older one a whole
+//  period before that.
+//
+float EmitSchedule::age(int k) const {
+	return (debt + (count - 1 - k)) / rate;
+}
+
+float EmitSchedule::birthtime(int k) const {
+	return time - age(k) * 1000.0;
+}
+
+void EmitSchedule::reset() {
+	debt = 0;
+	count = 0;
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include "ofMain.h"
+#include "SimClock.h"
+
+//  Turns a spawn rate into a whole number of spawns per step.  The
+//  fraction of a spawn left over ("debt") carries into the next step, so
+//  rates above the step rate aren't dropped and rates below it come out
+//  evenly spaced.  Each spawn of a step also gets its own birth time
+//  inside the step, so a fast stream comes out spread along its path
+//  instead of in clumps at the emitter.
+//
+class EmitSchedule {
+public:
+	int advance(float rate, const SimTime &t);   // returns the spawns due this step
+	float age(int k) const;         // sec, since spawn k of this step was born
+	float birthtime(int k) const;   // ms, same clock as SimTime::time
+	void reset();
+
+	float debt = 0;     // fraction of a spawn owed
+	int count = 0;      // spawns due this step, oldest first
+	float rate = 0;     // per sec, as of the last advance()
+	float time = 0;     // ms, end of the last step
+};
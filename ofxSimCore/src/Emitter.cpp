@@ -20,16 +20,16 @@ Emitter::Emitter(SpriteSystem *spriteSys) {
 }
 
 //  Draw the Emitter if it is drawable. In many cases you would want a hidden emitter
+//  "alpha" interpolates between the last two simulation steps.
 //
-//
-void Emitter::draw() {
+void Emitter::draw(float alpha) {
 
 	ofPushMatrix();
-	ofMultMatrix(getMatrix());
+	ofMultMatrix(getMatrix(alpha));
 
 	if (drawable) {
 		if (haveImage) {
-			image.draw(-image.getWidth() / 2.0, -image.getHeight() / 2.0);
+			image->draw(-image->getWidth() / 2.0, -image->getHeight() / 2.0);
 		}
 		else {
 			ofSetColor(0, 0, 200);
@@ -38,20 +38,28 @@ void Emitter::draw() {
 	}
 	ofPopMatrix();
 
-	sys->draw();
+	sys->draw(alpha);
 
 }
 
 //  Update the Emitter. If it has been started, spawn new sprites with
-//  initial velocity, lifespan, birthtime.
+//  initial velocity, lifespan, birthtime.  Sprites already alive are moved
+//  first, then all of this step's sprites are spawned together, each placed
+//  where it would be at the end of the step given its birth time inside it.
 //
-void Emitter::update() {
+void Emitter::update(const SimTime &t) {
+	saveState();
 	if (!started) return;
 
-	float time = ofGetElapsedTimeMillis();
-	if (started) {
-		if ((time - lastSpawned) > (1000.0 / rate)) {
-			shoot(time);
+	sys->update(t);
+
+	int n = schedule.advance(rate, t);
+	if (n > 0) {
+		if (!isEnemy && sounds) {
+			sounds->play("shoot");
+		}
+		for (int k = 0; k < n; k++) {
+			shoot(schedule.birthtime(k), schedule.age(k));
 		}
 	}
 
@@ -91,29 +99,28 @@ void Emitter::update() {
 		}
 	}
 
-	sys->update();
 }
 
-// Shoot one sprite
-void Emitter::shoot(float time) {
-	shootSound.load("sounds/shoot.wav");
-	shootSound.setVolume(0.06f);
-	if (!isEnemy) {
-		shootSound.play();
-	}
+// Shoot one sprite, born at "time" (ms) and "age" sec ago
+void Emitter::shoot(float time, float age) {
 
-	// spawn a new sprite
-	Sprite sprite;
+	// spawn a new sprite in a free slot of the system
+	Sprite &sprite = sys->spawn();
 	if (haveChildImage) {
 		sprite.setImage(childImage);
 	}
 	sprite.velocity = velocity;
 	sprite.lifespan = lifespan;
 	sprite.heading = heading;
+
+	// sprites drift along the emitter's heading, enemy sprites backwards.
+	// Was 7 and 5 pixels per drawn frame, these are the same at 60 fps.
+	//
+	sprite.speed = isEnemy ? -300 : 420;
 	sprite.setPosition(pos);
+	sprite.pos += (glm::vec3(sprite.velocity) + sprite.heading * sprite.speed) * age;
 	sprite.birthtime = time;
 	sprite.isEnemy = isEnemy;
-	sys->add(sprite);
 	lastSpawned = time;
 	//cout << "velocity = " << sprite.velocity << endl;
 }
@@ -155,7 +162,7 @@ void Emitter::move(MoveDir direction, int speed) {
 //
 void Emitter::start() {
 	started = true;
-	lastSpawned = ofGetElapsedTimeMillis();
+	schedule.reset();    // first sprite one period after the next update()
 }
 
 void Emitter::stop() {
@@ -170,35 +177,28 @@ void Emitter::setVelocity(ofVec3f v) {
 	velocity = v;
 }
 
-void Emitter::setChildImage(ofImage img) {
+void Emitter::setChildImage(ImageHandle img) {
 	childImage = img;
 	haveChildImage = true;
-	childWidth = img.getWidth();
-	childHeight = img.getHeight();
+	childWidth = img->getWidth();
+	childHeight = img->getHeight();
 }
 
-void Emitter::setImage(ofImage img) {
+void Emitter::setImage(ImageHandle img) {
 	image = img;
 	haveImage = true;
-	width = img.getWidth();
-	height = img.getHeight();
+	width = img->getWidth();
+	height = img->getHeight();
 }
 
 void Emitter::setRate(float r) {
 	rate = r;
 }
 
-// Integrator for simple trajectory physics
+// Integrator for simple trajectory physics. dt is the fixed simulation step
 //
-void Emitter::integrate() {
+void Emitter::integrate(float dt) {
 
-	// interval for this step
-	//
-	float dt = 1.0 / 60.0;
-
-	// update position based on velocity
-	//
-	pos += (velocity * dt);
 	rot += angularVelocity * dt;
 
 	// update acceleration with accumulated paritcles forces
@@ -208,14 +208,21 @@ void Emitter::integrate() {
 
 	accel += (forces * (1.0 / mass));
 	//cout << "integrate() = " << forces << endl;
-	velocity += accel * dt;
+
+	// update position and velocity, the forces are held for the step
+	//
+	ofVec3f p = pos;
+	integrateStep(integrator, p, velocity, [&](const ofVec3f &, const ofVec3f &) { return accel; }, dt);
+	pos = p;
 
 	//cout << "integrate() velocity = " << velocity << endl;
 
-	// add a little damping for good measure
+	// add a little damping for good measure, the same per second
+	// whatever the frame rate
 	//
-	velocity *= damping;
-	angularVelocity *= damping;
+	float d = dampingFactor(damping, dt);
+	velocity *= d;
+	angularVelocity *= d;
 
 	// clear forces on particle (they get re-added each step)
 	//
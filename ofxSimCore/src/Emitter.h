@@ -2,6 +2,9 @@
 
 #include "BaseObject.h"
 #include "SpriteSystem.h"
+#include "SoundBank.h"
+#include "EmitSchedule.h"
+#include "Integrator.h"
 
 //  General purpose Emitter class for emitting sprites
 //  This works similar to a Particle emitter
@@ -9,17 +12,17 @@
 class Emitter : public BaseObject {
 public:
 	Emitter(SpriteSystem *);
-	void draw();
+	void draw(float alpha = 1.0);
 	void start();
 	void stop();
 	void setLifespan(float);
 	void setVelocity(ofVec3f);
-	void setChildImage(ofImage);
+	void setChildImage(ImageHandle);
 	void setChildSize(float w, float h) { childWidth = w; childHeight = h; }
-	void setImage(ofImage);
+	void setImage(ImageHandle);
 	void setRate(float);
-	void update();
-	void shoot(float time);
+	void update(const SimTime &t);
+	void shoot(float time, float age = 0);
 	void move(MoveDir type, int speed);
 
 	SpriteSystem *sys;
@@ -27,10 +30,11 @@ public:
 	float lifespan;
 	float width, height;
 	float childWidth, childHeight;
-	float lastSpawned;
-	ofImage childImage;
-	ofImage image;
-	ofSoundPlayer shootSound;
+	float lastSpawned;   // ms, birth time of the last sprite
+	EmitSchedule schedule;
+	ImageHandle childImage;
+	ImageHandle image;
+	SoundBank *sounds = NULL;   // plays "shoot" when set
 
 	bool drawable;
 	bool started;
@@ -40,14 +44,15 @@ public:
 
 	EnemyType type;
 
-	void integrate();
+	void integrate(float dt);
 
 	ofVec3f velocity = ofVec3f(0, 0, 0);
 	float angularVelocity = 0;
 	ofVec3f acceleration;
 	ofVec3f forces;
-	float damping = 0.99;
+	float damping = 0.99;    // per 1/60 sec, see dampingFactor()
 	float mass = 1.0;
+	IntegratorType integrator = ExplicitEuler;
 
 	//ThrustForce *tForce;
 
@@ -0,0 +1,24 @@
+#include "FixedStep.h"
+
+FixedStep::FixedStep(float dt, int maxSteps) {
+	this->dt = dt;
+	this->maxSteps = maxSteps;
+	accumulator = 0;
+}
+
+int FixedStep::advance(float frameTime) {
+	accumulator += frameTime;
+
+	int steps = 0;
+	while (accumulator >= dt && steps < maxSteps) {
+		accumulator -= dt;
+		steps++;
+	}
+
+	// if we hit the cap, drop the rest of the backlog rather than
+	// trying to catch up on later frames
+	//
+	if (steps == maxSteps && accumulator >= dt) accumulator = 0;
+
+	return steps;
+}
@@ -0,0 +1,20 @@
+#pragma once
+#include "ofMain.h"
+
+//  Fixed timestep clock.  Real frame time is banked in an accumulator and
+//  spent in whole steps of "dt", so every system advances by the same
+//  amount per step regardless of vsync or frame rate.  alpha() is how far
+//  the render time sits between the last two steps, for interpolating
+//  what gets drawn.
+//
+class FixedStep {
+public:
+	FixedStep(float dt = 1.0 / 60.0, int maxSteps = 5);
+
+	int advance(float frameTime);   // bank frameTime (sec), returns the number of steps to run
+	float alpha() const { return accumulator / dt; }
+
+	float dt;          // sec per step
+	int maxSteps;      // cap per frame so a long hitch doesn't snowball
+	float accumulator;
+};
@@ -0,0 +1,86 @@
+#include "FrameProfiler.h"
+
+FrameProfiler::FrameProfiler(int window) {
+	this->window = window;
+	frames = 0;
+	total = { "frame", 0, 0, 0, 0, 0 };
+}
+
+//  Close out the last frame: fold this frame's times into the averages
+//  and start timing the next one.
+//
+void FrameProfiler::frame() {
+	uint64_t now = ofGetElapsedTimeMicros();
+	if (total.start > 0) total.ms = (now - total.start) / 1000.0;
+	total.start = now;
+
+	settle(total);
+	for (int i = 0; i < sections.size(); i++) {
+		settle(sections[i]);
+	}
+
+	// peaks are over the last "window" frames
+	//
+	if (++frames >= window) {
+		frames = 0;
+		total.peak = total.worst;
+		total.worst = 0;
+		for (int i = 0; i < sections.size(); i++) {
+			sections[i].peak = sections[i].worst;
+			sections[i].worst = 0;
+		}
+	}
+}
+
+void FrameProfiler::settle(Section &s) {
+	s.avg += (s.ms - s.avg) / window;
+	s.worst = std::max(s.worst, s.ms);
+	s.ms = 0;
+}
+
+void FrameProfiler::begin(const string &name) {
+	find(name).start = ofGetElapsedTimeMicros();
+}
+
+// a section timed more than once in a frame adds up
+//
+void FrameProfiler::end(const string &name) {
+	Section &s = find(name);
+	s.ms += (ofGetElapsedTimeMicros() - s.start) / 1000.0;
+}
+
+FrameProfiler::Section &FrameProfiler::find(const string &name) {
+	for (int i = 0; i < sections.size(); i++) {
+		if (sections[i].name == name) return sections[i];
+	}
+	sections.push_back({ name, 0, 0, 0, 0, 0 });
+	return sections.back();
+}
+
+//  One line per section: average and peak ms, and a bar scaled so the
+//  full width is the frame budget.  Anything over budget is drawn red.
+//
+void FrameProfiler::draw(float x, float y) {
+	float barWidth = 200;
+	float lineHeight = 15;
+
+	ofPushStyle();
+	for (int i = -1; i < (int)sections.size(); i++) {
+		const Section &s = i < 0 ? total : sections[i];
+		char line[128];
+		snprintf(line, sizeof(line), "%-12s %6.2f ms  peak %6.2f", s.name.c_str(), s.avg, s.peak);
+
+		ofSetColor(s.avg > budget ? ofColor::red : ofColor::white);
+		ofDrawBitmapString(line, x, y);
+
+		ofSetColor(s.avg > budget ? ofColor::red : ofColor::green);
+		ofDrawRectangle(x + 330, y - 9, std::min(barWidth, barWidth * s.avg / budget), 8);
+		ofNoFill();
+		ofSetColor(ofColor::gray);
+		ofDrawRectangle(x + 330, y - 9, barWidth, 8);
+		ofFill();
+
+		y += lineHeight;
+	}
+	ofPopStyle();
+}
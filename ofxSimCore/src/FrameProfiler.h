@@ -0,0 +1,37 @@
+#pragma once
+#include "ofMain.h"
+
+//  Per frame timings for named sections of a frame (update, draw, ...),
+//  averaged over a window of frames and drawn as an overlay with a bar
+//  per section against the frame budget.  Wrap each section in
+//  begin()/end() and call frame() once at the top of every update().
+//
+class FrameProfiler {
+public:
+	FrameProfiler(int window = 60);
+
+	void frame();
+	void begin(const string &name);
+	void end(const string &name);
+	void draw(float x, float y);
+
+	float budget = 1000.0 / 60.0;   // ms per frame
+
+	struct Section {
+		string name;
+		uint64_t start;   // usec
+		float ms;         // this frame
+		float avg;        // ms, moving average over the window
+		float peak;       // ms, worst frame in the last window
+		float worst;      // running peak for the current window
+	};
+	vector<Section> sections;   // in the order they were first seen
+	Section total;              // time between calls to frame()
+
+private:
+	Section &find(const string &name);
+	void settle(Section &s);
+
+	int window;
+	int frames;
+};
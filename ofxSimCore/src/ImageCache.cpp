@@ -0,0 +1,21 @@
+#include "ImageCache.h"
+
+map<string, ImageHandle> ImageCache::images;
+
+ImageHandle ImageCache::load(const string &path) {
+	map<string, ImageHandle>::iterator it = images.find(path);
+	if (it != images.end()) return it->second;
+
+	ImageHandle image = make_shared<ofImage>();
+	if (!image->load(path)) return NULL;
+
+	images[path] = image;
+	return image;
+}
+
+//  Drop the cache's references. Images still held by sprites stay alive
+//  until the last handle goes away.
+//
+void ImageCache::clear() {
+	images.clear();
+}
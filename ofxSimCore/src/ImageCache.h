@@ -0,0 +1,20 @@
+#pragma once
+#include "ofMain.h"
+
+//  Shared handle to an image owned by the ImageCache. Copying a handle only
+//  bumps a reference count, the pixels and texture are never duplicated.
+//
+typedef shared_ptr<ofImage> ImageHandle;
+
+//  Cache of images keyed by path. Every load() of the same path hands back
+//  the same image, so sprites can share one texture instead of each
+//  carrying its own ofImage copy.
+//
+class ImageCache {
+public:
+	static ImageHandle load(const string &path);   // returns NULL if the image can't be loaded
+	static void clear();
+
+private:
+	static map<string, ImageHandle> images;
+};
@@ -0,0 +1,17 @@
+#include "Integrator.h"
+
+const char *integratorName(IntegratorType type) {
+	switch (type) {
+	case ExplicitEuler: return "explicit euler";
+	case SemiImplicitEuler: return "semi-implicit euler";
+	case VelocityVerlet: return "velocity verlet";
+	case RK4: return "rk4";
+	}
+	return "";
+}
+
+float dampingFactor(float damping, float dt) {
+	float k = dt * 60.0f;
+	if (k == 1.0f) return damping;
+	return powf(damping, k);
+}
@@ -0,0 +1,69 @@
+#pragma once
+#include "ofMain.h"
+
+//  The integration schemes a ParticleSystem or a moving object can use.
+//
+//  ExplicitEuler      x += v dt, then v += a dt.  Cheapest, gains energy.
+//  SemiImplicitEuler  v += a dt, then x += v dt.  Same cost, stays bounded.
+//  VelocityVerlet     second order, two force evaluations per step.
+//  RK4                fourth order, four force evaluations per step.
+//
+//  Objects that only gather their forces once per step (Emitter, TriShip,
+//  Particle::integrate()) hold the acceleration constant across the step,
+//  so for them Verlet and RK4 both come to x += v dt + a dt^2 / 2 and
+//  SemiImplicitEuler is the better choice.
+//
+typedef enum { ExplicitEuler, SemiImplicitEuler, VelocityVerlet, RK4 } IntegratorType;
+
+const char *integratorName(IntegratorType type);
+
+//  "damping" is the fraction of velocity kept per 1/60 sec, the old per
+//  frame factor at 60 fps.  This is the factor for a step of dt, so the
+//  slowdown per second is the same at any frame rate.
+//
+float dampingFactor(float damping, float dt);
+
+//  Advance pos and vel by dt.  accel(pos, vel) returns the acceleration
+//  for a state, and is called once (Euler), twice (Verlet) or four times
+//  (RK4).  Damping is left to the caller.
+//
+template <class V, class F>
+void integrateStep(IntegratorType type, V &pos, V &vel, F accel, float dt) {
+	switch (type) {
+	case ExplicitEuler:
+	{
+		V a = accel(pos, vel);
+		pos += vel * dt;
+		vel += a * dt;
+	}
+	break;
+	case SemiImplicitEuler:
+		vel += accel(pos, vel) * dt;
+		pos += vel * dt;
+		break;
+	case VelocityVerlet:
+	{
+		V a0 = accel(pos, vel);
+		V p1 = pos + vel * dt + a0 * (0.5f * dt * dt);
+		V a1 = accel(p1, V(vel + a0 * dt));
+		pos = p1;
+		vel += (a0 + a1) * (0.5f * dt);
+	}
+	break;
+	case RK4:
+	{
+		float h = 0.5f * dt;
+		V k1v = accel(pos, vel);
+		V k1x = vel;
+		V k2x = vel + k1v * h;
+		V k2v = accel(V(pos + k1x * h), k2x);
+		V k3x = vel + k2v * h;
+		V k3v = accel(V(pos + k2x * h), k3x);
+		V k4x = vel + k3v * dt;
+		V k4v = accel(V(pos + k3x * dt), k4x);
+		pos += (k1x + (k2x + k3x) * 2.0f + k4x) * (dt / 6.0f);
+		vel += (k1v + (k2v + k3v) * 2.0f + k4v) * (dt / 6.0f);
+	}
+	break;
+	}
+}
@@ -0,0 +1,121 @@
+#include "JobSystem.h"
+
+// the queue index of the current thread, so a job that calls run() pushes
+// to and pops from its own queue
+//
+static thread_local int threadQueue = 0;
+
+JobSystem::JobSystem(int n) {
+	if (n <= 0) n = std::max(1, (int)std::thread::hardware_concurrency()) - 1;
+	steals = 0;
+	queued = 0;
+	quit = false;
+
+	for (int i = 0; i <= n; i++) {
+		queues.push_back(unique_ptr<Queue>(new Queue()));
+	}
+	for (int i = 1; i <= n; i++) {
+		threads.push_back(std::thread(&JobSystem::worker, this, i));
+	}
+}
+
+JobSystem::~JobSystem() {
+	{
+		std::lock_guard<std::mutex> guard(sleepLock);
+		quit = true;
+	}
+	wake.notify_all();
+	for (int i = 0; i < threads.size(); i++) {
+		threads[i].join();
+	}
+}
+
+//  Run every job and return when they have all finished.  Jobs are dealt
+//  round robin starting with this thread's own queue.
+//
+void JobSystem::run(vector<Job> &jobs) {
+	if (jobs.size() == 0) return;
+
+	std::atomic<int> pending(jobs.size());
+	int q = threadQueue < queues.size() ? threadQueue : 0;
+
+	// count them before they are visible so "queued" never dips below 0
+	//
+	{
+		std::lock_guard<std::mutex> guard(sleepLock);
+		queued += jobs.size();
+	}
+	for (int i = 0; i < jobs.size(); i++) {
+		Queue &queue = *queues[(q + i) % queues.size()];
+		std::lock_guard<std::mutex> guard(queue.lock);
+		queue.tasks.push_back({ &jobs[i], &pending });
+	}
+	wake.notify_all();
+
+	// help out until our group is done.  Jobs taken here may belong to
+	// another group, that's fine, they all have to run anyway.
+	//
+	Task task;
+	while (pending > 0) {
+		if (take(q, task)) {
+			(*task.job)();
+			(*task.pending)--;
+		}
+		else std::this_thread::yield();
+	}
+}
+
+//  Split [0, count) into chunks of "chunk" and run f(begin, end) on each.
+//
+void JobSystem::parallelFor(int count, int chunk, const std::function<void(int, int)> &f) {
+	vector<Job> jobs;
+	for (int begin = 0; begin < count; begin += chunk) {
+		int end = std::min(begin + chunk, count);
+		jobs.push_back([&f, begin, end]() { f(begin, end); });
+	}
+	run(jobs);
+}
+
+//  Pop the newest task from our own queue, or steal the oldest from
+//  someone else's.
+//
+bool JobSystem::take(int q, Task &task) {
+	{
+		Queue &own = *queues[q];
+		std::lock_guard<std::mutex> guard(own.lock);
+		if (!own.tasks.empty()) {
+			task = own.tasks.back();
+			own.tasks.pop_back();
+			queued--;
+			return true;
+		}
+	}
+	for (int i = 1; i < queues.size(); i++) {
+		Queue &other = *queues[(q + i) % queues.size()];
+		std::lock_guard<std::mutex> guard(other.lock);
+		if (!other.tasks.empty()) {
+			task = other.tasks.front();
+			other.tasks.pop_front();
+			queued--;
+			steals++;
+			return true;
+		}
+	}
+	return false;
+}
+
+void JobSystem::worker(int q) {
+	threadQueue = q;
+
+	Task task;
+	while (true) {
+		if (take(q, task)) {
+			(*task.job)();
+			(*task.pending)--;
+			continue;
+		}
+		std::unique_lock<std::mutex> guard(sleepLock);
+		wake.wait(guard, [this]() { return quit || queued > 0; });
+		if (quit) return;
+	}
+}
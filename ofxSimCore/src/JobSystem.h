@@ -0,0 +1,51 @@
+#pragma once
+#include "ofMain.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <functional>
+
+//  Small work-stealing thread pool.  run() spreads a group of jobs over
+//  one queue per thread and blocks until they are all done; the calling
+//  thread works through the queues too instead of just waiting.  A thread
+//  that runs out of work steals from the front of another queue.
+//
+//  run() can be called from inside a job (systems updating in parallel
+//  that each split their own update), the waiting job keeps helping so
+//  nothing deadlocks.
+//
+class JobSystem {
+public:
+	typedef std::function<void()> Job;
+
+	JobSystem(int threads = 0);     // 0 => one per core, less the caller
+	~JobSystem();
+
+	void run(vector<Job> &jobs);
+	void parallelFor(int count, int chunk, const std::function<void(int begin, int end)> &f);
+	int size() const { return (int)queues.size(); }   // threads doing work, caller included
+
+	std::atomic<int> steals;
+
+private:
+	struct Task {
+		Job *job;
+		std::atomic<int> *pending;
+	};
+	struct Queue {
+		std::mutex lock;
+		std::deque<Task> tasks;
+	};
+
+	bool take(int q, Task &task);   // own queue first, then steal
+	void worker(int q);
+
+	vector<std::thread> threads;
+	vector<unique_ptr<Queue>> queues;   // queue 0 is fed by the calling thread
+	std::mutex sleepLock;
+	std::condition_variable wake;
+	std::atomic<int> queued;
+	bool quit;
+};
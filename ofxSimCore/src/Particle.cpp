@@ -0,0 +1,230 @@
+#include "Particle.h"
+
+
+// append a particle to the store and initialize it with
+// some reasonable values first;
+//
+int ParticleStore::add() {
+	position.push_back(ofVec3f(0, 0, 0));
+	velocity.push_back(ofVec3f(0, 0, 0));
+	acceleration.push_back(ofVec3f(0, 0, 0));
+	forces.push_back(ofVec3f(0, 0, 0));
+	damping.push_back(.99);
+	mass.push_back(1);
+	lifespan.push_back(5);
+	radius.push_back(.1);
+	birthtime.push_back(0);
+	color.push_back(ofColor::floralWhite);
+	return end() - 1;
+}
+
+// append a copy of a particle. push_back copes with the view pointing
+// into this same store, so this is safe even while the arrays grow.
+//
+int ParticleStore::add(const Particle &p) {
+	position.push_back(p.position);
+	velocity.push_back(p.velocity);
+	acceleration.push_back(p.acceleration);
+	forces.push_back(p.forces);
+	damping.push_back(p.damping);
+	mass.push_back(p.mass);
+	lifespan.push_back(p.lifespan);
+	radius.push_back(p.radius);
+	birthtime.push_back(p.birthtime);
+	color.push_back(p.color);
+	return end() - 1;
+}
+
+// remove a particle by moving the last one into its slot, so
+// removal is O(1) at the cost of not preserving order.  An ordered store
+// shifts everything after it down one instead.
+//
+void ParticleStore::remove(int i) {
+	int last = end() - 1;
+	if (ordered) {
+		for (int j = i; j < last; j++) move(j + 1, j);
+	}
+	else if (i != last) move(last, i);
+	resize(size() - 1);
+}
+
+// remove a set of particles given in ascending order.  An ordered store is
+// compacted in a single pass from the first hole, so taking k particles out
+// costs O(n) rather than k shifts of everything after them.
+//
+void ParticleStore::remove(const vector<int> &sorted) {
+	int count = sorted.size();
+	if (count == 0) return;
+	if (!ordered) {
+		for (int k = count - 1; k >= 0; k--) remove(sorted[k]);
+		return;
+	}
+
+	int to = sorted[0];
+	int k = 0;
+	for (int from = sorted[0]; from < end(); from++) {
+		if (k < count && from == sorted[k]) {
+			k++;
+			continue;
+		}
+		move(from, to++);
+	}
+	resize(size() - count);
+}
+
+// expire the n oldest particles of an ordered store.  Once the expired
+// slots outnumber the live particles, the live ones are slid back to the
+// front, so each particle is copied at most once on average and the arrays
+// never need more than twice the live count.
+//
+void ParticleStore::dropFront(int n) {
+	first += n;
+	int live = size();
+	if (live == 0) {
+		clear();
+		return;
+	}
+	if (first < live) return;
+	slideToFront();
+}
+
+// move the live particles down to index 0
+//
+void ParticleStore::slideToFront() {
+	int live = size();
+	for (int i = 0; i < live; i++) move(first + i, i);
+	first = 0;
+	resize(live);
+}
+
+// the unordered code assumes begin() is 0, so leaving ordered mode closes
+// the gap the expired particles left at the front
+//
+void ParticleStore::setOrdered(bool o) {
+	if (!o && first > 0) slideToFront();
+	ordered = o;
+}
+
+// append n particles with the same values as add(), growing each array
+// once instead of n times.
+//
+int ParticleStore::add(int n) {
+	int start = end();
+	int last = start + n;
+	position.resize(last);
+	velocity.resize(last);
+	acceleration.resize(last);
+	forces.resize(last);
+	damping.resize(last, .99);
+	mass.resize(last, 1);
+	lifespan.resize(last, 5);
+	radius.resize(last, .1);
+	birthtime.resize(last, 0);
+	color.resize(last, ofColor::floralWhite);
+	return start;
+}
+
+// copy particle "from" over the top of particle "to"
+//
+void ParticleStore::move(int from, int to) {
+	position[to] = position[from];
+	velocity[to] = velocity[from];
+	acceleration[to] = acceleration[from];
+	forces[to] = forces[from];
+	damping[to] = damping[from];
+	mass[to] = mass[from];
+	lifespan[to] = lifespan[from];
+	radius[to] = radius[from];
+	birthtime[to] = birthtime[from];
+	color[to] = color[from];
+}
+
+// shrink (or grow) every array at once to n live particles
+//
+void ParticleStore::resize(int n) {
+	n += first;
+	position.resize(n);
+	velocity.resize(n);
+	acceleration.resize(n);
+	forces.resize(n);
+	damping.resize(n);
+	mass.resize(n);
+	lifespan.resize(n);
+	radius.resize(n);
+	birthtime.resize(n);
+	color.resize(n);
+}
+
+void ParticleStore::reserve(int n) {
+	position.reserve(n);
+	velocity.reserve(n);
+	acceleration.reserve(n);
+	forces.reserve(n);
+	damping.reserve(n);
+	mass.reserve(n);
+	lifespan.reserve(n);
+	radius.reserve(n);
+	birthtime.reserve(n);
+	color.reserve(n);
+}
+
+void ParticleStore::clear() {
+	first = 0;
+	position.clear();
+	velocity.clear();
+	acceleration.clear();
+	forces.clear();
+	damping.clear();
+	mass.clear();
+	lifespan.clear();
+	radius.clear();
+	birthtime.clear();
+	color.clear();
+}
+
+
+Particle::Particle(ParticleStore &s, int i) :
+	position(s.position[i]),
+	velocity(s.velocity[i]),
+	acceleration(s.acceleration[i]),
+	forces(s.forces[i]),
+	damping(s.damping[i]),
+	mass(s.mass[i]),
+	lifespan(s.lifespan[i]),
+	radius(s.radius[i]),
+	birthtime(s.birthtime[i]),
+	color(s.color[i]),
+	index(i) {
+}
+
+// write your own integrator here.. (hint: it's only 3 lines of code)
+//
+void Particle::integrate(float dt, IntegratorType type) {
+
+	// update acceleration with accumulated paritcles forces
+	// remember :  (f = ma) OR (a = 1/m * f)
+	//
+	ofVec3f accel = acceleration;    // start with any acceleration already on the particle
+	accel += (forces * (1.0 / mass));
+
+	// update position and velocity, the forces are held for the step
+	//
+	integrateStep(type, position, velocity, [&](const ofVec3f &, const ofVec3f &) { return accel; }, dt);
+
+	// add a little damping for good measure, the same per second
+	// whatever the frame rate
+	//
+	velocity *= dampingFactor(damping, dt);
+
+	// clear forces on particle (they get re-added each step)
+	//
+	forces.set(0, 0, 0);
+}
+
+//  return age in seconds at time "now" (ms)
+//
+float Particle::age(float now) {
+	return (now - birthtime) / 1000.0;
+}
+
+
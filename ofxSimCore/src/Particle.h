@@ -0,0 +1,78 @@
+#pragma once
+
+#include "ofMain.h"
+#include "Integrator.h"
+
+class ParticleForceField;
+class Particle;
+
+//  Structure-of-arrays storage for the particles in a ParticleSystem.
+//  Each attribute lives in its own contiguous array so the force and
+//  integrate passes stream linearly through memory.
+//
+//  The live particles are [begin(), end()).  begin() is always 0 unless
+//  the store is "ordered" (FIFO): then particles stay in the order they
+//  were added and the oldest are expired by moving begin() forward, not by
+//  moving anything.  The expired slots are reclaimed once there are as many
+//  of them as live particles, by sliding the live ones back to the front.
+//
+class ParticleStore {
+public:
+	int  size() const { return (int)position.size() - first; }
+	int  begin() const { return first; }
+	int  end() const { return (int)position.size(); }
+	int  add();           // append a particle with default values, returns its index
+	int  add(const Particle &);
+	int  add(int n);      // append n default particles at once, returns the first index
+	void remove(int i);   // swap-and-pop, or shift down when ordered
+	void remove(const vector<int> &sorted);   // many at once, ascending indices
+	void dropFront(int n);   // ordered only, expire the n oldest
+	void setOrdered(bool o);   // leaving ordered mode slides the live particles to 0
+	void move(int from, int to);
+	void resize(int n);   // number of live particles
+	void reserve(int n);
+	void clear();
+
+	bool ordered = false;
+	int first = 0;
+
+	vector<ofVec3f> position;
+	vector<ofVec3f> velocity;
+	vector<ofVec3f> acceleration;
+	vector<ofVec3f> forces;
+	vector<float>   damping;
+	vector<float>   mass;
+	vector<float>   lifespan;
+	vector<float>   radius;
+	vector<float>   birthtime;
+	vector<ofColor> color;
+
+private:
+	void slideToFront();
+};
+
+//  Lightweight view of a single particle in a ParticleStore. The fields are
+//  references into the store's arrays, so a view is only valid until particles
+//  are added to or removed from the store.
+//
+class Particle {
+public:
+	Particle(ParticleStore &store, int i);
+
+	ofVec3f &position;
+	ofVec3f &velocity;
+	ofVec3f &acceleration;
+	ofVec3f &forces;
+	float	&damping;
+	float   &mass;
+	float   &lifespan;
+	float   &radius;
+	float   &birthtime;
+	ofColor &color;
+	int     index;
+	void    integrate() { integrate(1.0 / ofGetFrameRate()); }
+	void    integrate(float dt, IntegratorType type = ExplicitEuler);
+	float   age(float now);   // sec, "now" in ms
+};
+
+
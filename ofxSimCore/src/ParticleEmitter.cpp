@@ -0,0 +1,260 @@
+
+//  Kevin M. Smith - CS 134 SJSU
+
+#include "ParticleEmitter.h"
+
+ParticleEmitter::ParticleEmitter() {
+	sys = new ParticleSystem();
+	createdSys = true;
+	init();
+}
+
+ParticleEmitter::ParticleEmitter(ParticleSystem *s) {
+	if (s == NULL)
+	{
+		cout << "fatal error: null particle system passed to ParticleEmitter()" << endl;
+		ofExit();
+	}
+	sys = s;
+	createdSys = false;
+	init();
+}
+
+ParticleEmitter::~ParticleEmitter() {
+
+	// deallocate particle system if emitter created one internally
+	//
+	if (createdSys) delete sys;
+}
+
+void ParticleEmitter::init() {
+	rate = 1;
+	velocity = ofVec3f(0, 20, 0);
+	lifespan = 3;
+	started = false;
+	oneShot = false;
+	fired = false;
+	lastSpawned = 0;
+	radius = 1;
+	surface = false;
+	coneAngle = 30;
+	fifo = false;
+	maxBursts = 1;
+	particleRadius = .1;
+	visible = true;
+	type = DirectionalEmitter;
+	groupSize = 1;
+}
+
+
+
+void ParticleEmitter::draw() {
+	if (visible) {
+		switch (type) {
+		case DirectionalEmitter:
+			ofDrawSphere(position, radius / 10);  // just draw a small sphere for point emitters 
+			break;
+		case SphereEmitter:
+		case DiscEmitter:
+		case ConeEmitter:
+		case RadialEmitter:
+			ofDrawSphere(position, radius / 10);  // just draw a small sphere as a placeholder
+			break;
+		default:
+			break;
+		}
+	}
+	sys->draw();
+}
+// start() begins a fresh schedule, so the first spawn is one period
+// after the first update().
+//
+void ParticleEmitter::start() {
+	started = true;
+	schedule.reset();
+}
+
+void ParticleEmitter::stop() {
+	started = false;
+	fired = false;
+}
+//  Particles already alive are updated first, then this step's spawns are
+//  added in one insert and placed where they would be at the end of the
+//  step, given their birth time inside it.  Forces act on them from the
+//  next step.
+//
+void ParticleEmitter::update(const SimTime &t) {
+	sys->update(t);
+
+	// back to FIFO once the particles of an old lifespan are gone
+	//
+	if (fifo && !sys->particles.ordered && sys->size() == 0) updateFifo();
+	if (!started) return;
+
+	if (oneShot) {
+		if (!fired) {
+
+			// spawn a new particle(s)
+			//
+			spawnGroup(groupSize, t.time);
+
+			lastSpawned = t.time;
+		}
+		fired = true;
+		stop();
+		return;
+	}
+
+	int n = schedule.advance(rate, t);
+	if (n == 0) return;
+
+	int first = sys->addGroup(n * groupSize);
+	for (int k = 0; k < n; k++) {
+		initGroup(first + k * groupSize, groupSize, schedule.birthtime(k), schedule.age(k));
+	}
+	lastSpawned = schedule.birthtime(n - 1);
+}
+
+//  FIFO expiry stops at the first live particle, so it is only right while
+//  every live particle has the same lifespan.  A change with particles
+//  alive drops the system back to the compacting scan until it empties,
+//  see update().
+//
+void ParticleEmitter::setLifespan(const float life) {
+	if (life == lifespan) return;
+	lifespan = life;
+	if (fifo && sys->size() > 0) sys->setFifo(0);
+	else updateFifo();
+}
+
+//  Turning FIFO off puts the system back on the compacting scan, even with
+//  particles alive.
+//
+void ParticleEmitter::setFifo(bool f) {
+	fifo = f;
+	if (!fifo) sys->setFifo(0);
+	updateFifo();
+}
+
+//  Most particles alive at once: "maxBursts" groups for a one shot that is
+//  restarted while its last burst is still alive, otherwise a lifespan's
+//  worth of groups plus the one being spawned.
+//
+int ParticleEmitter::fifoCapacity() const {
+	if (oneShot) return maxBursts * groupSize;
+	return ((int)ceil(rate * lifespan) + 1) * groupSize;
+}
+
+//  Seed the spawn directions and the system's force noise together, so one
+//  number reproduces the whole emitter.
+//
+void ParticleEmitter::setSeed(uint64_t s) {
+	rng.setSeed(s);
+	sys->seed = s;
+	sys->rng.setSeed(s + 1);
+}
+
+// spawn a single particle.  time is current time of birth
+//
+void ParticleEmitter::spawn(float time) {
+	spawnGroup(1, time);
+}
+
+// spawn "count" particles in one insert, born at "time" (ms) and "age" sec
+// ago
+//
+void ParticleEmitter::spawnGroup(int count, float time, float age) {
+	initGroup(sys->addGroup(count), count, time, age);
+}
+
+// a direction uniformly distributed over the unit sphere: z is uniform in
+// [-1, 1] and the angle around z uniform, which by Archimedes' hat-box
+// theorem covers the sphere evenly.  Normalizing a random point in a cube
+// instead bunches directions toward the corners.
+//
+static inline ofVec3f sphereDir(Random &rng) {
+	float z = rng.random(-1, 1);
+	float a = rng.random(0, TWO_PI);
+	float s = sqrt(1 - z * z);
+	return ofVec3f(s * cos(a), s * sin(a), z);
+}
+
+// set up particles [first, first + count), born at "time" (ms) and "age"
+// sec ago, so they have already moved that far from where they started.
+// Writes straight into the store's arrays with one loop per shape.
+//
+void ParticleEmitter::initGroup(int first, int count, float time, float age) {
+	if (count <= 0) return;
+
+	ParticleStore &store = sys->particles;
+	ofVec3f *pos = &store.position[first];
+	ofVec3f *vel = &store.velocity[first];
+
+	// axis and a basis around it for the disc and cone
+	//
+	float speed = velocity.length();
+	ofVec3f axis = speed > 0 ? velocity / speed : ofVec3f(0, 1, 0);
+	ofVec3f u = axis.getCrossed(fabs(axis.x) < .9 ? ofVec3f(1, 0, 0) : ofVec3f(0, 1, 0)).getNormalized();
+	ofVec3f v = axis.getCrossed(u);
+
+	switch (type) {
+	case DirectionalEmitter:
+		for (int i = 0; i < count; i++) {
+			vel[i] = velocity;
+			pos[i] = position;
+		}
+		break;
+	case RadialEmitter:
+		for (int i = 0; i < count; i++) {
+			vel[i] = sphereDir(rng) * speed;
+			pos[i] = position;
+		}
+		break;
+	case SphereEmitter:
+
+		// cube root so the volume fills evenly instead of crowding the center
+		//
+		for (int i = 0; i < count; i++) {
+			ofVec3f dir = sphereDir(rng);
+			float r = surface ? radius : radius * cbrt(rng.random());
+			vel[i] = dir * speed;
+			pos[i] = position + dir * r;
+		}
+		break;
+	case DiscEmitter:
+
+		// square root for the same reason, by area
+		//
+		for (int i = 0; i < count; i++) {
+			float a = rng.random(0, TWO_PI);
+			float r = surface ? radius : radius * sqrt(rng.random());
+			vel[i] = velocity;
+			pos[i] = position + (u * cos(a) + v * sin(a)) * r;
+		}
+		break;
+	case ConeEmitter:
+	{
+		// uniform over the spherical cap: z uniform in [cos(angle), 1]
+		//
+		float zmin = cos(ofDegToRad(coneAngle));
+		for (int i = 0; i < count; i++) {
+			float z = rng.random(zmin, 1);
+			float a = rng.random(0, TWO_PI);
+			float s = sqrt(1 - z * z);
+			vel[i] = (axis * z + (u * cos(a) + v * sin(a)) * s) * speed;
+			pos[i] = position;
+		}
+	}
+	break;
+	}
+
+	for (int i = 0; i < count; i++) {
+		pos[i] += vel[i] * age;
+	}
+
+	// other particle attributes
+	//
+	std::fill_n(&store.lifespan[first], count, lifespan);
+	std::fill_n(&store.birthtime[first], count, time);
+	std::fill_n(&store.radius[first], count, particleRadius);
+}
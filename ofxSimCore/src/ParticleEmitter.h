@@ -0,0 +1,71 @@
+#pragma once
+//  Kevin M. Smith - CS 134 SJSU
+
+#include "TransformObject.h"
+#include "ParticleSystem.h"
+#include "EmitSchedule.h"
+
+//  Directional: all along "velocity" from the emitter's position.
+//  Radial:      from the position, in uniformly random directions.
+//  Sphere:      from inside (or on the surface of) a sphere of "radius",
+//               moving straight out from its center.
+//  Disc:        from a disc of "radius" facing "velocity", moving along it.
+//  Cone:        from the position, within "coneAngle" of "velocity".
+//
+typedef enum { DirectionalEmitter, RadialEmitter, SphereEmitter, DiscEmitter, ConeEmitter } EmitterType;
+
+//  General purpose Emitter class for emitting sprites
+//  This works similar to a Particle emitter
+//
+class ParticleEmitter : public TransformObject {
+public:
+	ParticleEmitter();
+	ParticleEmitter(ParticleSystem *s);
+	~ParticleEmitter();
+	void init();
+	void draw();
+	void start();
+	void stop();
+	void setLifespan(const float life);
+	void setVelocity(const ofVec3f &vel) { velocity = vel; }
+	void setRate(const float r) { rate = r; updateFifo(); }
+	void setParticleRadius(const float r) { particleRadius = r; }
+	void setEmitterType(EmitterType t) { type = t; }
+	void setGroupSize(int s) { groupSize = s; updateFifo(); }
+	void setOneShot(bool s) { oneShot = s; updateFifo(); }
+	void setRadius(float r) { radius = r; }
+	void setSurface(bool s) { surface = s; }
+	void setConeAngle(float a) { coneAngle = a; }
+	void setFifo(bool f);    // see ParticleSystem::setFifo()
+	void setMaxBursts(int n) { maxBursts = n; updateFifo(); }
+	int fifoCapacity() const;
+	void setSeed(uint64_t s);     // emitter and its system's random streams
+	void update(const SimTime &t);
+	void spawn(float time);
+	void spawnGroup(int count, float time, float age = 0);
+	void initGroup(int first, int count, float time, float age);
+	ParticleSystem *sys;
+	float rate;         // per sec
+	bool oneShot;
+	bool fired;
+	ofVec3f velocity;
+	float lifespan;     // sec
+	bool started;
+	float lastSpawned;  // ms, birth time of the last spawn
+	EmitSchedule schedule;
+	float particleRadius;
+	float radius;       // size of the sphere and disc shapes
+	bool surface;       // sphere: on the surface, disc: on the rim
+	float coneAngle;    // degrees either side of the cone's axis
+	bool visible;
+	int groupSize;      // number of particles to spawn in a group
+	bool createdSys;
+	bool fifo;          // all particles share "lifespan", so expire them in order
+	                    // (suspended while particles of an older lifespan are alive)
+	int maxBursts;      // one shot: groups alive at once, for fifoCapacity()
+	EmitterType type;
+	Random rng;
+
+private:
+	void updateFifo() { if (fifo) sys->setFifo(fifoCapacity()); }
+};
@@ -0,0 +1,118 @@
+#include "ParticleGrid.h"
+
+ParticleGrid::ParticleGrid(float cellSize) {
+	this->cellSize = cellSize;
+	invCell = 1;
+	built = false;
+	tableSize = 1;
+}
+
+// cell size should be about the usual query radius.  Left at 0 it is
+// chosen from the bounding box so there are roughly as many cells along
+// the longest axis as the cube root of the particle count.
+//
+void ParticleGrid::setCellSize(float s) {
+	cellSize = s > 0 ? s : 0;
+	built = false;
+}
+
+void ParticleGrid::build(const ParticleStore &store) {
+	int first = store.begin();
+	int n = store.size();
+
+	float size = cellSize;
+	if (size <= 0) {
+		glm::vec3 lo = store.position[first], hi = store.position[first];
+		for (int i = first + 1; i < store.end(); i++) {
+			lo = glm::min(lo, (glm::vec3)store.position[i]);
+			hi = glm::max(hi, (glm::vec3)store.position[i]);
+		}
+		glm::vec3 extent = hi - lo;
+		float longest = std::max(extent.x, std::max(extent.y, extent.z));
+		size = longest / std::max(1.0f, cbrtf((float)n));
+		if (size <= 0) size = 1;
+	}
+	invCell = 1.0f / size;
+
+	tableSize = 1;
+	while (tableSize < 2 * n) tableSize <<= 1;
+
+	// counting sort by bucket, same as SpatialHash
+	//
+	entries.resize(n);
+	bucketStart.assign(tableSize + 1, 0);
+	for (int i = 0; i < n; i++) {
+		const ofVec3f &p = store.position[first + i];
+		Entry &e = entries[i];
+		e.cx = cell(p.x);
+		e.cy = cell(p.y);
+		e.cz = cell(p.z);
+		e.index = first + i;
+		bucketStart[bucket(e.cx, e.cy, e.cz) + 1]++;
+	}
+	for (int b = 0; b < tableSize; b++)
+		bucketStart[b + 1] += bucketStart[b];
+
+	sorted.resize(n);
+	next.assign(bucketStart.begin(), bucketStart.end() - 1);
+	for (int i = 0; i < n; i++) {
+		const Entry &e = entries[i];
+		sorted[next[bucket(e.cx, e.cy, e.cz)]++] = e;
+	}
+
+	built = true;
+}
+
+template <class F>
+void ParticleGrid::visit(const ParticleStore &store, const glm::vec3 &min, const glm::vec3 &max, F f) {
+	int n = store.size();
+	if (n == 0) return;
+	if (!built) build(store);
+
+	int x0 = cell(min.x), x1 = cell(max.x);
+	int y0 = cell(min.y), y1 = cell(max.y);
+	int z0 = cell(min.z), z1 = cell(max.z);
+
+	// a region covering more cells than there are particles is cheaper
+	// to answer with a straight scan
+	//
+	double cells = double(x1 - x0 + 1) * double(y1 - y0 + 1) * double(z1 - z0 + 1);
+	if (cells > n) {
+		for (int i = store.begin(); i < store.end(); i++) f(i);
+		return;
+	}
+
+	for (int cx = x0; cx <= x1; cx++) {
+		for (int cy = y0; cy <= y1; cy++) {
+			for (int cz = z0; cz <= z1; cz++) {
+				unsigned int b = bucket(cx, cy, cz);
+				for (int k = bucketStart[b]; k < bucketStart[b + 1]; k++) {
+					const Entry &e = sorted[k];
+
+					// different cells can share a bucket, so check the cell too
+					//
+					if (e.cx == cx && e.cy == cy && e.cz == cz) f(e.index);
+				}
+			}
+		}
+	}
+}
+
+void ParticleGrid::queryRadius(const ParticleStore &store, const glm::vec3 &p, float dist, vector<int> &out) {
+	out.clear();
+	glm::vec3 r(dist, dist, dist);
+	float dist2 = dist * dist;
+	visit(store, p - r, p + r, [&](int i) {
+		glm::vec3 d = (glm::vec3)store.position[i] - p;
+		if (glm::dot(d, d) < dist2) out.push_back(i);
+	});
+}
+
+void ParticleGrid::queryBox(const ParticleStore &store, const glm::vec3 &min, const glm::vec3 &max, vector<int> &out) {
+	out.clear();
+	visit(store, min, max, [&](int i) {
+		const ofVec3f &q = store.position[i];
+		if (q.x >= min.x && q.x <= max.x && q.y >= min.y && q.y <= max.y && q.z >= min.z && q.z <= max.z)
+			out.push_back(i);
+	});
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "ofMain.h"
+#include "Particle.h"
+
+//  Uniform 3D grid over the particles of a ParticleStore, the particle
+//  version of SpatialHash.  Cells are hashed into a power of two table and
+//  particle indices are counting-sorted by bucket.  The grid is built
+//  lazily on the first query after invalidate(), so a system that is never
+//  queried never pays for it.
+//
+class ParticleGrid {
+public:
+	ParticleGrid(float cellSize = 0);
+
+	void setCellSize(float s);     // 0 => pick one from the particle bounds
+	void invalidate() { built = false; }
+	bool isBuilt() const { return built; }
+
+	// indices of particles within "dist" of p / inside the box [min, max]
+	//
+	void queryRadius(const ParticleStore &store, const glm::vec3 &p, float dist, vector<int> &out);
+	void queryBox(const ParticleStore &store, const glm::vec3 &min, const glm::vec3 &max, vector<int> &out);
+
+private:
+	void build(const ParticleStore &store);
+	int cell(float v) const { return (int)floor(v * invCell); }
+	unsigned int bucket(int cx, int cy, int cz) const {
+		return ((unsigned int)cx * 73856093u ^ (unsigned int)cy * 19349663u ^ (unsigned int)cz * 83492791u) & (tableSize - 1);
+	}
+
+	// visit every particle in the cells overlapping [min, max], f(index)
+	//
+	template <class F> void visit(const ParticleStore &store, const glm::vec3 &min, const glm::vec3 &max, F f);
+
+	struct Entry {
+		int cx, cy, cz;
+		int index;
+	};
+
+	float cellSize;      // as set, 0 for automatic
+	float invCell;       // 1 / cell size in use
+	bool built;
+	unsigned int tableSize;
+	vector<Entry> entries;     // in particle order
+	vector<Entry> sorted;      // grouped by bucket
+	vector<int> bucketStart;   // bucket b is sorted[bucketStart[b] .. bucketStart[b + 1])
+	vector<int> next;
+};
@@ -0,0 +1,577 @@
+
+// Kevin M.Smith - CS 134 SJSU
+
+#include "ParticleSystem.h"
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define PARTICLE_SSE
+#endif
+
+ParticleSystem::ParticleSystem() {
+
+	// the particle mesh is refilled every frame
+	//
+	mesh.setUsage(GL_STREAM_DRAW);
+}
+
+//  add a new particle with default values and return a view of it
+//  so the caller can fill in its attributes.
+//
+Particle ParticleSystem::add() {
+	grid.invalidate();
+	return Particle(particles, particles.add());
+}
+
+void ParticleSystem::add(const Particle &p) {
+	grid.invalidate();
+	particles.add(p);
+}
+
+int ParticleSystem::addGroup(int n) {
+	grid.invalidate();
+	return particles.add(n);
+}
+
+void ParticleSystem::addForce(ParticleForce *f) {
+	forces.push_back(f);
+}
+
+void ParticleSystem::remove(int i) {
+	grid.invalidate();
+	particles.remove(i);
+}
+
+void ParticleSystem::setLifespan(float l) {
+	for (int i = particles.begin(); i < particles.end(); i++) {
+		particles.lifespan[i] = l;
+	}
+}
+
+//  Keep the particles in the order they are added and expire them from the
+//  front, which is only right if every particle has the same lifespan.
+//  The arrays are reserved for twice "capacity" live particles, see
+//  ParticleStore::dropFront(), so a steady stream never reallocates.
+//  A capacity of 0 goes back to the compacting scan.
+//
+void ParticleSystem::setFifo(int capacity) {
+	grid.invalidate();
+	particles.setOrdered(capacity > 0);
+	if (capacity > 0) particles.reserve(2 * capacity);
+}
+
+void ParticleSystem::reset() {
+	for (int i = 0; i < forces.size(); i++) {
+		forces[i]->applied = false;
+	}
+}
+
+//  Check which particles have exceed their lifespan and compact the
+//  survivors down to the front of the store in a single pass, then trim
+//  the arrays once.  This keeps culling O(n) even when a whole burst
+//  expires on the same frame.  Ages come from the step's time, not a
+//  clock read per particle.  In FIFO order the expired ones are all at
+//  the front, so only they are looked at.
+//
+void ParticleSystem::expire(const SimTime &t) {
+	if (particles.ordered) {
+		int i = particles.begin();
+		while (i < particles.end()) {
+			float life = particles.lifespan[i];
+			if (life == -1 || t.time - particles.birthtime[i] <= life * 1000.0f) break;
+			i++;
+		}
+		particles.dropFront(i - particles.begin());
+	}
+	else {
+		int alive = 0;
+		for (int i = 0; i < particles.size(); i++) {
+			float life = particles.lifespan[i];
+			if (life != -1 && t.time - particles.birthtime[i] > life * 1000.0f) continue;
+			if (alive != i) particles.move(i, alive);
+			alive++;
+		}
+		particles.resize(alive);
+	}
+}
+
+void ParticleSystem::update(const SimTime &t) {
+	grid.invalidate();
+
+	// check if empty and just return
+	if (particles.size() == 0) return;
+
+	expire(t);
+
+	// particles may all have expired
+	//
+	if (particles.size() == 0) return;
+
+	// forces that can't be split into chunks go first, over every
+	// particle on this thread.  Their results sit in the force array and
+	// are integrated with the rest.
+	//
+	int first = particles.begin();
+	int n = particles.size();
+	applySerialForces(first, first + n, t);
+
+	// apply forces and integrate in chunks.  Chunks don't share anything,
+	// so with a JobSystem they run on as many threads as it has.  The
+	// chunking is the same either way, so is the result.
+	//
+	if (jobs) {
+		jobs->parallelFor(n, chunkSize, [this, &t, first](int begin, int end) { updateChunk(first + begin, first + end, t); });
+	}
+	else {
+		for (int begin = 0; begin < n; begin += chunkSize)
+			updateChunk(first + begin, first + std::min(begin + chunkSize, n), t);
+	}
+
+	// update all forces only applied once to "applied"
+	// so they are not applied again.
+	//
+	for (int i = 0; i < forces.size(); i++) {
+		if (forces[i]->applyOnce)
+			forces[i]->applied = true;
+	}
+
+}
+
+//  Forces and integration for particles [begin, end).  Each chunk's random
+//  stream is seeded from the system's seed, the frame and where the chunk
+//  starts, never from which thread picks it up.
+//
+void ParticleSystem::updateChunk(int begin, int end, const SimTime &t) {
+	ParticleBatch batch(particles, begin, end, seed * 0x9E3779B97F4A7C15ull + ((uint64_t)t.frame << 32) + begin);
+	if (integrator == VelocityVerlet || integrator == RK4) {
+		integrateStaged(batch, t.dt);
+		return;
+	}
+	for (int k = 0; k < forces.size(); k++) {
+		if (!forces[k]->applied && forces[k]->threadSafe())
+			forces[k]->applyBatch(batch);
+	}
+	integrate(begin, end, t.dt);
+}
+
+//  The forces that are not threadSafe(), for particles [begin, end) in one
+//  batch on the calling thread.  Seeded apart from the chunks' streams.
+//
+void ParticleSystem::applySerialForces(int begin, int end, const SimTime &t) {
+	ParticleBatch batch(particles, begin, end, ~(seed * 0x9E3779B97F4A7C15ull + ((uint64_t)t.frame << 32)));
+	for (int k = 0; k < forces.size(); k++) {
+		if (!forces[k]->applied && !forces[k]->threadSafe())
+			forces[k]->applyBatch(batch);
+	}
+}
+
+//  Add the thread safe forces that are still to be applied, the one shot
+//  ones or the others, to a batch.
+//
+void ParticleSystem::applyForces(const ParticleBatch &batch, bool once) {
+	for (int k = 0; k < forces.size(); k++) {
+		if (!forces[k]->applied && forces[k]->threadSafe() && forces[k]->applyOnce == once)
+			forces[k]->applyBatch(batch);
+	}
+}
+
+//  Velocity Verlet or RK4 for a chunk.  The forces are evaluated again at
+//  each stage's positions and velocities, through a copy of the batch
+//  pointed at scratch arrays.  Each copy starts from the same random
+//  stream, so a noise force like turbulence gives a particle the same push
+//  at every stage of a step.  One shot forces (and anything already in the
+//  force array, which includes the forces that are not threadSafe()) are
+//  worked out once and held for the whole step.
+//
+void ParticleSystem::integrateStaged(const ParticleBatch &batch, float dt) {
+	int n = batch.count;
+	if (n <= 0) return;
+
+	thread_local vector<ofVec3f> scratch;
+	scratch.resize(6 * n);
+	ofVec3f *held = &scratch[0];
+	ofVec3f *xs = &scratch[n];
+	ofVec3f *vs = &scratch[2 * n];
+	ofVec3f *a = &scratch[3 * n];
+	ofVec3f *sumX = &scratch[4 * n];
+	ofVec3f *sumV = &scratch[5 * n];
+
+	ofVec3f *x0 = batch.position;
+	ofVec3f *v0 = batch.velocity;
+	const ofVec3f *acc = &particles.acceleration[batch.begin];
+	const float *mass = batch.mass;
+	const float *damp = &particles.damping[batch.begin];
+
+	applyForces(batch, true);
+	for (int i = 0; i < n; i++) held[i] = batch.forces[i];
+
+	// acceleration at state (x, v) into a.  A thread safe force on the
+	// default applyBatch() still lands in the store's array, so pick
+	// that up too.
+	//
+	auto accel = [&](ofVec3f *x, ofVec3f *v) {
+		ParticleBatch b = batch;
+		b.position = x;
+		b.velocity = v;
+		b.forces = a;
+		for (int i = 0; i < n; i++) {
+			a[i] = held[i];
+			batch.forces[i] = ofVec3f(0, 0, 0);
+		}
+		applyForces(b, false);
+		for (int i = 0; i < n; i++) a[i] = acc[i] + (a[i] + batch.forces[i]) / mass[i];
+	};
+
+	if (integrator == VelocityVerlet) {
+		accel(x0, v0);
+		for (int i = 0; i < n; i++) {
+			sumV[i] = a[i];
+			xs[i] = x0[i] + v0[i] * dt + a[i] * (0.5f * dt * dt);
+			vs[i] = v0[i] + a[i] * dt;
+		}
+		accel(xs, vs);
+		for (int i = 0; i < n; i++) {
+			x0[i] = xs[i];
+			v0[i] += (sumV[i] + a[i]) * (0.5f * dt);
+		}
+	}
+	else {
+		// stages 1 to 4: evaluate at (xs, vs), weigh in, step to the next
+		//
+		const float weight[4] = { 1, 2, 2, 1 };
+		const float next[4] = { 0.5f * dt, 0.5f * dt, dt, 0 };
+		for (int i = 0; i < n; i++) {
+			xs[i] = x0[i];
+			vs[i] = v0[i];
+			sumX[i] = sumV[i] = ofVec3f(0, 0, 0);
+		}
+		for (int s = 0; s < 4; s++) {
+			accel(xs, vs);
+			for (int i = 0; i < n; i++) {
+				ofVec3f kx = vs[i];
+				sumX[i] += kx * weight[s];
+				sumV[i] += a[i] * weight[s];
+				xs[i] = x0[i] + kx * next[s];
+				vs[i] = v0[i] + a[i] * next[s];
+			}
+		}
+		for (int i = 0; i < n; i++) {
+			x0[i] += sumX[i] * (dt / 6.0f);
+			v0[i] += sumV[i] * (dt / 6.0f);
+		}
+	}
+
+	for (int i = 0; i < n; i++) {
+		v0[i] *= dampingFactor(damp[i], dt);
+		batch.forces[i] = ofVec3f(0, 0, 0);
+	}
+}
+
+// Batch integrator for particles [begin, end), explicit or semi-implicit
+// Euler (semi-implicit also stands in for Verlet and RK4 in
+// StaticParticleSystem).  Same math as Particle::integrate() but with dt
+// computed once per frame and the store's arrays treated as flat floats,
+// so four particles (twelve floats, three SSE registers) are advanced per
+// step.  Falls back to a scalar loop for the tail or when SSE is missing.
+//
+void ParticleSystem::integrate(int begin, int end, float dt) {
+	static_assert(sizeof(ofVec3f) == 3 * sizeof(float), "ofVec3f must be 3 packed floats");
+
+	int n = end - begin;
+	if (n <= 0) return;
+
+	float *pos = &particles.position[begin].x;
+	float *vel = &particles.velocity[begin].x;
+	const float *acc = &particles.acceleration[begin].x;
+	float *frc = &particles.forces[begin].x;
+	const float *mass = &particles.mass[begin];
+	const float *damp = &particles.damping[begin];
+
+	// damping is per 1/60 sec, scale it to this step.  Particles nearly
+	// always share one value, so only recompute when it changes.
+	//
+	thread_local vector<float> scaled;
+	if (dt * 60.0f != 1.0f) {
+		scaled.resize(n);
+		float last = -1, factor = 1;
+		for (int k = 0; k < n; k++) {
+			if (damp[k] != last) {
+				last = damp[k];
+				factor = dampingFactor(last, dt);
+			}
+			scaled[k] = factor;
+		}
+		damp = scaled.data();
+	}
+	bool semi = integrator != ExplicitEuler;
+
+	int i = 0;
+
+#ifdef PARTICLE_SSE
+	const __m128 vdt = _mm_set1_ps(dt);
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 zero = _mm_setzero_ps();
+
+	for (; i + 4 <= n; i += 4) {
+
+		// per particle scalars for particles a, b, c, d are spread to line
+		// up with the xyz triples:  [a a a b] [b b c c] [c d d d]
+		//
+		__m128 im = _mm_div_ps(one, _mm_loadu_ps(mass + i));
+		__m128 dm = _mm_loadu_ps(damp + i);
+		__m128 ims[3] = {
+			_mm_shuffle_ps(im, im, _MM_SHUFFLE(1, 0, 0, 0)),
+			_mm_shuffle_ps(im, im, _MM_SHUFFLE(2, 2, 1, 1)),
+			_mm_shuffle_ps(im, im, _MM_SHUFFLE(3, 3, 3, 2))
+		};
+		__m128 dms[3] = {
+			_mm_shuffle_ps(dm, dm, _MM_SHUFFLE(1, 0, 0, 0)),
+			_mm_shuffle_ps(dm, dm, _MM_SHUFFLE(2, 2, 1, 1)),
+			_mm_shuffle_ps(dm, dm, _MM_SHUFFLE(3, 3, 3, 2))
+		};
+
+		for (int k = 0; k < 3; k++) {
+			int j = 3 * i + 4 * k;
+			__m128 p = _mm_loadu_ps(pos + j);
+			__m128 v = _mm_loadu_ps(vel + j);
+			__m128 a = _mm_loadu_ps(acc + j);
+			__m128 f = _mm_loadu_ps(frc + j);
+
+			// x += v * dt;  v = (v + (a + f / m) * dt) * damping
+			// or for semi-implicit the other way round
+			//
+			if (!semi) p = _mm_add_ps(p, _mm_mul_ps(v, vdt));
+			a = _mm_add_ps(a, _mm_mul_ps(f, ims[k]));
+			v = _mm_mul_ps(_mm_add_ps(v, _mm_mul_ps(a, vdt)), dms[k]);
+			if (semi) p = _mm_add_ps(p, _mm_mul_ps(v, vdt));
+
+			_mm_storeu_ps(pos + j, p);
+			_mm_storeu_ps(vel + j, v);
+			_mm_storeu_ps(frc + j, zero);
+		}
+	}
+#endif
+
+	// scalar path for whatever is left
+	//
+	for (; i < n; i++) {
+		float im = 1.0f / mass[i];
+		for (int c = 3 * i; c < 3 * i + 3; c++) {
+			if (!semi) pos[c] += vel[c] * dt;
+			vel[c] = (vel[c] + (acc[c] + frc[c] * im) * dt) * damp[i];
+			if (semi) pos[c] += vel[c] * dt;
+			frc[c] = 0;
+		}
+	}
+}
+
+// remove all particlies within "dist" of point, returns the number removed
+//
+int ParticleSystem::removeNear(const ofVec3f & point, float dist) {
+	queryRadius(point, dist, found);
+	int count = found.size();
+	if (count == 0) return 0;
+
+	// all in one call, so a FIFO store is compacted once rather than
+	// shifted once per particle
+	//
+	std::sort(found.begin(), found.end());
+	particles.remove(found);
+	grid.invalidate();
+	return count;
+}
+
+//  indices of the particles within "dist" of p
+//
+void ParticleSystem::queryRadius(const glm::vec3 &p, float dist, vector<int> &out) {
+	grid.queryRadius(particles, p, dist, out);
+}
+
+//  indices of the particles inside the box [min, max]
+//
+void ParticleSystem::queryBox(const glm::vec3 &min, const glm::vec3 &max, vector<int> &out) {
+	grid.queryBox(particles, min, max, out);
+}
+
+//  draw the particle cloud as a single mesh of camera facing quads
+//  instead of one sphere draw call per particle.
+//
+void ParticleSystem::draw() {
+	if (particles.size() == 0) return;
+
+	// the view matrix rows give the camera's right and up axes
+	//
+	glm::mat4 view = ofGetCurrentViewMatrix();
+	glm::vec3 right = glm::vec3(view[0][0], view[1][0], view[2][0]);
+	glm::vec3 up = glm::vec3(view[0][1], view[1][1], view[2][1]);
+
+	buildMesh(mesh, right, up);
+
+	// give every particle a new random color each frame
+	//
+	if (sparkle) {
+		vector<ofFloatColor> &colors = mesh.getColors();
+		for (int i = 0; i < colors.size(); i += 4) {
+			ofFloatColor c(rng.random(), rng.random(), rng.random());
+			colors[i] = colors[i + 1] = colors[i + 2] = colors[i + 3] = c;
+		}
+	}
+	ofSetColor(255, 255, 255);
+	mesh.draw();
+}
+
+//  fill a mesh with one quad (two triangles) per particle, sized by the
+//  particle radius and facing along right/up.  This does not touch GL,
+//  so it can be run and checked without a window.
+//
+void ParticleSystem::buildMesh(ofMesh &m, const glm::vec3 &right, const glm::vec3 &up) {
+	int first = particles.begin();
+	int n = particles.size();
+	m.setMode(OF_PRIMITIVE_TRIANGLES);
+
+	vector<glm::vec3> &verts = m.getVertices();
+	vector<ofFloatColor> &colors = m.getColors();
+	vector<ofIndexType> &indices = m.getIndices();
+	verts.resize(4 * n);
+	colors.resize(4 * n);
+	indices.resize(6 * n);
+
+	for (int k = 0; k < n; k++) {
+		int i = first + k;
+		glm::vec3 c = particles.position[i];
+		glm::vec3 dx = right * particles.radius[i];
+		glm::vec3 dy = up * particles.radius[i];
+		int v = 4 * k;
+
+		verts[v] = c - dx - dy;
+		verts[v + 1] = c + dx - dy;
+		verts[v + 2] = c + dx + dy;
+		verts[v + 3] = c - dx + dy;
+
+		ofFloatColor color = particles.color[i];
+		colors[v] = colors[v + 1] = colors[v + 2] = colors[v + 3] = color;
+
+		ofIndexType *idx = &indices[6 * k];
+		idx[0] = v; idx[1] = v + 1; idx[2] = v + 2;
+		idx[3] = v; idx[4] = v + 2; idx[5] = v + 3;
+	}
+}
+
+
+ParticleBatch::ParticleBatch(ParticleStore &s, int b, int e, uint64_t seed) : rng(seed) {
+	store = &s;
+	begin = b;
+	count = e - b;
+	position = count > 0 ? &s.position[b] : NULL;
+	velocity = count > 0 ? &s.velocity[b] : NULL;
+	forces = count > 0 ? &s.forces[b] : NULL;
+	mass = count > 0 ? &s.mass[b] : NULL;
+}
+
+// default batch - fall back to the per particle virtual
+//
+void ParticleForce::applyBatch(const ParticleBatch &batch) {
+	for (int i = 0; i < batch.count; i++) {
+		Particle p(*batch.store, batch.begin + i);
+		updateForce(&p);
+	}
+}
+
+
+// Gravity Force Field 
+//
+GravityForce::GravityForce(const ofVec3f &g) {
+	gravity = g;
+}
+
+void GravityForce::updateForce(Particle * particle) {
+	//
+	// f = mg
+	//
+	particle->forces += gravity * particle->mass;
+}
+
+void GravityForce::applyBatch(const ParticleBatch &batch) {
+	for (int i = 0; i < batch.count; i++)
+		batch.forces[i] += at(batch, i);
+}
+
+void GravityForce::set(const ofVec3f &g) {
+	gravity = g;
+}
+
+// Turbulence Force Field 
+//
+TurbulenceForce::TurbulenceForce(const ofVec3f &min, const ofVec3f &max) {
+	tmin = min;
+	tmax = max;
+}
+
+void TurbulenceForce::updateForce(Particle * particle) {
+	//
+	// We are going to add a little "noise" to a particles
+	// forces to achieve a more natual look to the motion
+	//
+	particle->forces.x += rng.random(tmin.x, tmax.x);
+	particle->forces.y += rng.random(tmin.y, tmax.y);
+	particle->forces.z += rng.random(tmin.z, tmax.z);
+}
+
+void TurbulenceForce::applyBatch(const ParticleBatch &batch) {
+	for (int i = 0; i < batch.count; i++)
+		batch.forces[i] += at(batch, i);
+}
+
+void TurbulenceForce::set(const ofVec3f &min, const ofVec3f &max) {
+	tmin = min;
+	tmax = max;
+}
+
+
+
+// Impulse Radial Force - this is a "one shot" force that
+// eminates radially outward in random directions.
+//
+ImpulseRadialForce::ImpulseRadialForce(float magnitude, float height) {
+	this->magnitude = magnitude;
+	this->height = height;
+	applyOnce = true;
+}
+
+void ImpulseRadialForce::updateForce(Particle * particle) {
+
+	// we basically create a random direction for each particle
+	// the force is only added once after it is triggered.
+	//
+	ofVec3f dir = ofVec3f(rng.random(-1, 1), rng.random(-height, height), rng.random(-1, 1));
+	particle->forces += dir.getNormalized() * magnitude;
+}
+
+void ImpulseRadialForce::applyBatch(const ParticleBatch &batch) {
+	for (int i = 0; i < batch.count; i++)
+		batch.forces[i] += at(batch, i);
+}
+
+void ImpulseRadialForce::setHeight(float height) {
+	this->height = height;
+}
+
+CyclicForce::CyclicForce(float magnitude) {
+	this->magnitude = magnitude;
+}
+
+void CyclicForce::updateForce(Particle * particle) {
+	ofVec3f pos = particle->position;
+	ofVec3f norm = pos.getNormalized();
+	ofVec3f dir = norm.cross(ofVec3f(0, 1, 0));
+	particle->forces += dir.getNormalized() * magnitude;
+}
+
+void CyclicForce::applyBatch(const ParticleBatch &batch) {
+	for (int i = 0; i < batch.count; i++)
+		batch.forces[i] += at(batch, i);
+}
+
+void CyclicForce::setMagnitude(float magnitude) {
+	this->magnitude = magnitude;
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+#pragma once
+#include "ofMain.h"
+#include "Particle.h"
+#include "SimClock.h"
+#include "JobSystem.h"
+#include "Random.h"
+#include "ParticleGrid.h"
+
+
+//  A contiguous run of particles in a ParticleStore, handed to a force in
+//  one call.  The pointers are the store's arrays offset to "begin".
+//  Forces that need noise draw it from random(), a stream owned by the
+//  batch, so batches can run on different threads and still give the
+//  same answer.
+//
+class ParticleBatch {
+public:
+	ParticleBatch(ParticleStore &store, int begin, int end, uint64_t seed = 0);
+	float random(float min, float max) const { return rng.random(min, max); }
+	ParticleStore *store;
+	int begin;
+	int count;
+	ofVec3f *position;
+	ofVec3f *velocity;
+	ofVec3f *forces;
+	float   *mass;
+	mutable Random rng;
+};
+
+//  Pure Virtual Function Class - must be subclassed to create new forces.
+//  applyBatch() defaults to calling updateForce() per particle; the built-in
+//  forces override it with a single loop over the arrays.
+//
+//  With a JobSystem attached, chunks of a system are updated on several
+//  threads at once.  Only forces whose threadSafe() is true are applied
+//  per chunk; the rest are applied to the whole system on the updating
+//  thread first, so a plain updateForce() never runs concurrently.
+//
+class ParticleForce {
+protected:
+public:
+	bool applyOnce = false;
+	bool applied = false;
+	virtual void updateForce(Particle *) = 0;
+	virtual void applyBatch(const ParticleBatch &);
+	virtual bool threadSafe() const { return false; }   // applyBatch() may run on several chunks at once
+};
+
+//  update() and reset() are virtual so an emitter can drive a
+//  StaticParticleSystem through the same pointer.
+//
+class ParticleSystem {
+public:
+	ParticleSystem();
+	virtual ~ParticleSystem() {}
+	Particle add();
+	void add(const Particle &);
+	int addGroup(int n);     // n default particles in one insert, returns the first index
+	Particle get(int i) { return Particle(particles, i); }    // i in [particles.begin(), particles.end())
+	int size() const { return particles.size(); }
+	void addForce(ParticleForce *);
+	void remove(int);
+	virtual void update(const SimTime &t);
+	void expire(const SimTime &t);
+	void updateChunk(int begin, int end, const SimTime &t);
+	void integrate(int begin, int end, float dt);
+	void integrateStaged(const ParticleBatch &batch, float dt);
+	void applyForces(const ParticleBatch &batch, bool once);
+	void applySerialForces(int begin, int end, const SimTime &t);
+	void integrateAll(float dt) { integrate(particles.begin(), particles.end(), dt); }
+	void setLifespan(float);
+	void setFifo(int capacity);    // 0 turns FIFO mode off
+	virtual void reset();
+	int removeNear(const ofVec3f & point, float dist);
+	void queryRadius(const glm::vec3 &p, float dist, vector<int> &out);
+	void queryBox(const glm::vec3 &min, const glm::vec3 &max, vector<int> &out);
+	void setGridCellSize(float s) { grid.setCellSize(s); }
+	void draw();
+	void buildMesh(ofMesh &m, const glm::vec3 &right, const glm::vec3 &up);
+	ParticleStore particles;
+	vector<ParticleForce *> forces;
+	ofVboMesh mesh;      // rebuilt every frame in draw()
+	bool sparkle = false;   // draw each particle in a new random color every frame
+	IntegratorType integrator = ExplicitEuler;
+	JobSystem *jobs = NULL;   // when set, update() runs its chunks across threads
+	int chunkSize = 1024;     // particles per chunk
+	uint64_t seed = 0;        // chunk random streams are derived from this
+	Random rng;               // for anything drawn outside the chunks (sparkle)
+
+	// index for the queries, rebuilt on the first query after particles are
+	// added, removed or updated.  Call grid.invalidate() after moving
+	// particles through the store directly.
+	//
+	ParticleGrid grid;
+	vector<int> found;
+};
+
+
+
+// Some convenient built-in forces.  at() is the force on particle i of a
+// batch; applyBatch() loops over it and StaticParticleSystem inlines it.
+//
+class GravityForce: public ParticleForce {
+	ofVec3f gravity;
+public:
+	GravityForce(const ofVec3f & gravity);
+	void updateForce(Particle *);
+	void applyBatch(const ParticleBatch &);
+	bool threadSafe() const { return true; }
+	void set(const ofVec3f &g);
+	ofVec3f at(const ParticleBatch &b, int i) const { return gravity * b.mass[i]; }
+};
+
+class TurbulenceForce : public ParticleForce {
+	ofVec3f tmin, tmax;
+	Random rng;     // updateForce() only, batches use their own stream
+public:
+	TurbulenceForce(const ofVec3f & min, const ofVec3f &max);
+	void updateForce(Particle *);
+	void applyBatch(const ParticleBatch &);
+	bool threadSafe() const { return true; }
+	void set(const ofVec3f &min, const ofVec3f &max);
+	ofVec3f at(const ParticleBatch &b, int i) const {
+		float x = b.random(tmin.x, tmax.x);
+		float y = b.random(tmin.y, tmax.y);
+		float z = b.random(tmin.z, tmax.z);
+		return ofVec3f(x, y, z);
+	}
+};
+
+class ImpulseRadialForce : public ParticleForce {
+	float magnitude;
+	float height;
+	Random rng;     // updateForce() only, batches use their own stream
+public:
+	ImpulseRadialForce(float magnitude, float height); 
+	void updateForce(Particle *);
+	void applyBatch(const ParticleBatch &);
+	bool threadSafe() const { return true; }
+	void setHeight(float height);
+	ofVec3f at(const ParticleBatch &b, int i) const {
+		float x = b.random(-1, 1);
+		float y = b.random(-height, height);
+		float z = b.random(-1, 1);
+		return ofVec3f(x, y, z).getNormalized() * magnitude;
+	}
+};
+
+class CyclicForce : public ParticleForce {
+	float magnitude;
+public:
+	CyclicForce(float magnitude);
+	void updateForce(Particle *);
+	void applyBatch(const ParticleBatch &);
+	bool threadSafe() const { return true; }
+	void setMagnitude(float magnitude);
+	ofVec3f at(const ParticleBatch &b, int i) const {
+		ofVec3f dir = b.position[i].getNormalized().cross(ofVec3f(0, 1, 0));
+		return dir.getNormalized() * magnitude;
+	}
+};
@@ -0,0 +1,15 @@
+#include "Random.h"
+
+//  Spread the seed over the whole state with splitmix64, so seeds that are
+//  close together (0, 1, 2 ...) still give unrelated streams.
+//
+void Random::setSeed(uint64_t seed) {
+	for (int i = 0; i < 2; i++) {
+		uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		z = z ^ (z >> 31);
+		s[2 * i] = (uint32_t)z;
+		s[2 * i + 1] = (uint32_t)(z >> 32);
+	}
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <stdint.h>
+
+//  Small seedable random number generator (xoshiro128+).  Much cheaper
+//  than ofRandom(), which goes through the global rand() state, and each
+//  system or emitter owns its own so runs repeat exactly from a seed and
+//  threads never share state.
+//
+class Random {
+public:
+	Random(uint64_t seed = 0) { setSeed(seed); }
+	void setSeed(uint64_t seed);
+
+	uint32_t next() {
+		uint32_t result = s[0] + s[3];
+		uint32_t t = s[1] << 9;
+		s[2] ^= s[0];
+		s[3] ^= s[1];
+		s[1] ^= s[2];
+		s[0] ^= s[3];
+		s[2] ^= t;
+		s[3] = (s[3] << 11) | (s[3] >> 21);
+		return result;
+	}
+
+	// uniform in [0, 1), built from the top 24 bits
+	//
+	float random() { return (next() >> 8) * (1.0f / 16777216.0f); }
+	float random(float min, float max) { return min + (max - min) * random(); }
+
+	uint32_t s[4];
+};
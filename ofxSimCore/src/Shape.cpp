@@ -0,0 +1,83 @@
+//
+//   CS134 - Spring 2021 Midterm Starter File
+//
+//
+//   (c) Kevin M. Smith 2021
+//
+//   Unauthorized copying or distribution of this source code is prohibited by law
+//
+
+#include "Shape.h"
+
+void TriangleShape::draw() {
+
+
+	if (bSelected)
+		ofSetColor(ofColor::white);
+	else
+		ofSetColor(color);
+
+
+	// tell OpenGL to transform all points using the "current transformation matrix" (CTM);
+	//
+	ofPushMatrix();
+	ofMultMatrix(getMatrix());   // get the current transform for the object.
+
+	// now everything I draw will be transformed by the matrix "T"
+	ofDrawTriangle(verts[0], verts[1], verts[2]);
+
+	ofPopMatrix();
+
+
+}
+
+
+// inside() test method - check to see if point p is inside triangle.
+// how could you improve the design of this method ?
+//
+bool TriangleShape::inside(glm::vec3 p) {
+	glm::vec3 v1 = glm::normalize(verts[0] - p);
+	glm::vec3 v2 = glm::normalize(verts[1] - p);
+	glm::vec3 v3 = glm::normalize(verts[2] - p);
+	float a1 = glm::orientedAngle(v1, v2, glm::vec3(0, 0, 1));
+	float a2 = glm::orientedAngle(v2, v3, glm::vec3(0, 0, 1));
+	float a3 = glm::orientedAngle(v3, v1, glm::vec3(0, 0, 1));
+	if (a1 < 0 && a2 < 0 && a3 < 0) return true;
+	else return false;
+}
+
+void TriShip::setColor(ofColor color) {
+	this->color = color;
+}
+
+// Integrator for simple trajectory physics
+//
+void TriShip::integrate(float dt) {
+
+	rotation += angularVelocity * dt;
+
+	// update acceleration with accumulated paritcles forces
+	// remember :  (f = ma) OR (a = 1/m * f)
+	//
+	ofVec3f accel = acceleration;    // start with any acceleration already on the particle
+
+	accel += (forces * (1.0 / mass));
+
+	// update position and velocity, the forces are held for the step
+	//
+	ofVec3f p = pos;
+	integrateStep(integrator, p, velocity, [&](const ofVec3f &, const ofVec3f &) { return accel; }, dt);
+	pos = p;
+
+
+	// add a little damping for good measure, the same per second
+	// whatever the frame rate
+	//
+	float d = dampingFactor(damping, dt);
+	velocity *= d;
+	angularVelocity *= d;
+
+	// clear forces on particle (they get re-added each step)
+	//
+	forces.set(0, 0, 0);
+}
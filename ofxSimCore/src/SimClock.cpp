@@ -0,0 +1,20 @@
+#include "SimClock.h"
+
+SimClock::SimClock(bool virtualTime) {
+	this->virtualTime = virtualTime;
+	reset();
+}
+
+const SimTime &SimClock::tick(float dt) {
+	if (virtualTime) current.time += dt * 1000.0;
+	else current.time = ofGetElapsedTimeMillis();
+	current.dt = dt;
+	current.frame++;
+	return current;
+}
+
+void SimClock::reset() {
+	current.time = virtualTime ? 0 : ofGetElapsedTimeMillis();
+	current.dt = 0;
+	current.frame = 0;
+}
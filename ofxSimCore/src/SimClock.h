@@ -0,0 +1,29 @@
+#pragma once
+#include "ofMain.h"
+
+//  The time for one simulation step.  It is read once per step and passed
+//  down through every update, so particles and sprites compute their age
+//  from "time" instead of each asking the system clock.
+//
+class SimTime {
+public:
+	float time = 0;    // ms, same clock as the birthtimes
+	float dt = 0;      // sec covered by this step
+	int frame = 0;     // number of steps taken so far
+};
+
+//  Hands out one SimTime per step.  By default "time" follows
+//  ofGetElapsedTimeMillis(); a virtual clock only advances by the dt of
+//  each tick() so a run can be replayed exactly.
+//
+class SimClock {
+public:
+	SimClock(bool virtualTime = false);
+
+	const SimTime &tick(float dt);   // advance one step
+	const SimTime &now() const { return current; }
+	void reset();
+
+	bool virtualTime;
+	SimTime current;
+};
@@ -0,0 +1,64 @@
+#include "SoundBank.h"
+
+SoundBank::SoundBank() {
+	framePlays = 0;
+	frameLoads = 0;
+	steals = 0;
+	totalLoads = 0;
+	totalPlays = 0;
+}
+
+//  Load "path" into "voices" players under "name".  Each player is loaded
+//  separately - copying a loaded ofSoundPlayer would share one channel.
+//
+bool SoundBank::load(const string &name, const string &path, int voices, float volume) {
+	Sound &sound = sounds[name];
+	sound.voices.clear();
+	sound.voices.resize(voices);
+	sound.started.assign(voices, 0);
+
+	for (int i = 0; i < voices; i++) {
+		if (!sound.voices[i].load(path)) {
+			ofLogError("SoundBank: can't load sound: " + path);
+			sounds.erase(name);
+			return false;
+		}
+		sound.voices[i].setVolume(volume);
+		frameLoads++;
+		totalLoads++;
+	}
+	return true;
+}
+
+void SoundBank::play(const string &name) {
+	map<string, Sound>::iterator it = sounds.find(name);
+	if (it == sounds.end()) return;
+	Sound &sound = it->second;
+
+	// find an idle voice; if there isn't one, steal the oldest
+	//
+	int voice = -1;
+	int oldest = 0;
+	for (int i = 0; i < sound.voices.size(); i++) {
+		if (!sound.voices[i].isPlaying()) {
+			voice = i;
+			break;
+		}
+		if (sound.started[i] < sound.started[oldest]) oldest = i;
+	}
+	if (voice == -1) {
+		voice = oldest;
+		sound.voices[voice].stop();
+		steals++;
+	}
+
+	sound.voices[voice].play();
+	sound.started[voice] = ofGetElapsedTimeMillis();
+	framePlays++;
+	totalPlays++;
+}
+
+void SoundBank::newFrame() {
+	framePlays = 0;
+	frameLoads = 0;
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include "ofMain.h"
+
+//  A set of named sounds, each loaded once up front into a fixed pool of
+//  voices (one ofSoundPlayer per voice).  play() uses an idle voice, or
+//  steals the voice that started longest ago when they are all busy, so
+//  firing a sound never touches the disk.
+//
+class SoundBank {
+public:
+	SoundBank();
+	bool load(const string &name, const string &path, int voices = 4, float volume = 1.0);
+	void play(const string &name);
+	void newFrame();      // call at the top of update() to reset the per frame counters
+
+	// counters
+	//
+	int framePlays;       // plays since newFrame()
+	int frameLoads;       // loads since newFrame()
+	int steals;           // total voices cut off to play a new sound
+	int totalLoads;
+	int totalPlays;
+
+private:
+	struct Sound {
+		vector<ofSoundPlayer> voices;
+		vector<uint64_t> started;    // ms, when each voice last started
+	};
+	map<string, Sound> sounds;
+};
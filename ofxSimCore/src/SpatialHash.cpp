@@ -0,0 +1,96 @@
+#include "SpatialHash.h"
+
+SpatialHash::SpatialHash(float cellSize) {
+	this->cellSize = cellSize;
+	built = false;
+	tableSize = 1;
+}
+
+// cell size should be about the collision distance so a query
+// only has to visit the 3x3 block of cells around a point
+//
+void SpatialHash::setCellSize(float s) {
+	if (s > 0) cellSize = s;
+	built = false;
+}
+
+void SpatialHash::clear() {
+	entries.clear();
+	built = false;
+}
+
+//  Add all sprites in a system to the grid
+//
+void SpatialHash::insert(SpriteSystem *sys) {
+	for (int i = 0; i < sys->sprites.size(); i++) {
+		if (sys->sprites[i].dead) continue;
+
+		Entry e;
+		e.pos = sys->sprites[i].pos;
+		e.cx = cell(e.pos.x);
+		e.cy = cell(e.pos.y);
+		e.ref.sys = sys;
+		e.ref.index = i;
+		entries.push_back(e);
+	}
+	built = false;
+}
+
+//  Counting sort the entries into buckets.  Called lazily on the first
+//  query after the grid changes.
+//
+void SpatialHash::build() {
+	tableSize = 1;
+	while (tableSize < 2 * entries.size()) tableSize <<= 1;
+
+	bucketStart.assign(tableSize + 1, 0);
+	for (int i = 0; i < entries.size(); i++)
+		bucketStart[bucket(entries[i].cx, entries[i].cy) + 1]++;
+	for (int b = 0; b < tableSize; b++)
+		bucketStart[b + 1] += bucketStart[b];
+
+	sorted.resize(entries.size());
+	vector<int> next(bucketStart.begin(), bucketStart.end() - 1);
+	for (int i = 0; i < entries.size(); i++)
+		sorted[next[bucket(entries[i].cx, entries[i].cy)]++] = entries[i];
+
+	built = true;
+}
+
+void SpatialHash::query(const glm::vec3 &p, float dist, vector<SpriteRef> &out) {
+	out.clear();
+	if (entries.size() == 0) return;
+	if (!built) build();
+
+	int x0 = cell(p.x - dist), x1 = cell(p.x + dist);
+	int y0 = cell(p.y - dist), y1 = cell(p.y + dist);
+
+	for (int cx = x0; cx <= x1; cx++) {
+		for (int cy = y0; cy <= y1; cy++) {
+			unsigned int b = bucket(cx, cy);
+			for (int k = bucketStart[b]; k < bucketStart[b + 1]; k++) {
+				const Entry &e = sorted[k];
+
+				// different cells can share a bucket, so check the cell too
+				//
+				if (e.cx != cx || e.cy != cy) continue;
+				if (glm::length(e.pos - p) < dist)
+					out.push_back(e.ref);
+			}
+		}
+	}
+}
+
+void SpatialHash::pairs(SpriteSystem *sys, float dist, vector<SpritePair> &out) {
+	out.clear();
+	for (int i = 0; i < sys->sprites.size(); i++) {
+		query(sys->sprites[i].pos, dist, found);
+		for (int k = 0; k < found.size(); k++) {
+			SpritePair pair;
+			pair.a.sys = sys;
+			pair.a.index = i;
+			pair.b = found[k];
+			out.push_back(pair);
+		}
+	}
+}
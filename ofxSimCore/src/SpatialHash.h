@@ -0,0 +1,58 @@
+#pragma once
+#include "ofMain.h"
+#include "SpriteSystem.h"
+
+//  Reference to one sprite in a SpriteSystem
+//
+struct SpriteRef {
+	SpriteSystem *sys;
+	int index;
+};
+
+//  Two sprites within the query distance of each other
+//
+struct SpritePair {
+	SpriteRef a;
+	SpriteRef b;
+};
+
+//  Uniform grid over sprite positions, rebuilt every frame: clear(), insert()
+//  each SpriteSystem, then query.  Grid cells are hashed into a power of two
+//  table and the entries are counting-sorted by bucket, so a query only
+//  looks at the handful of sprites in the cells around the query point.
+//
+class SpatialHash {
+public:
+	SpatialHash(float cellSize = 50);
+
+	void setCellSize(float s);
+	void clear();
+	void insert(SpriteSystem *sys);
+
+	// sprites within "dist" of p
+	//
+	void query(const glm::vec3 &p, float dist, vector<SpriteRef> &out);
+
+	// every sprite of sys paired with each sprite in the grid within "dist" of it
+	//
+	void pairs(SpriteSystem *sys, float dist, vector<SpritePair> &out);
+
+private:
+	struct Entry {
+		int cx, cy;
+		glm::vec3 pos;
+		SpriteRef ref;
+	};
+
+	void build();
+	int cell(float v) { return (int)floor(v / cellSize); }
+	unsigned int bucket(int cx, int cy) { return ((unsigned int)cx * 73856093u ^ (unsigned int)cy * 19349663u) & (tableSize - 1); }
+
+	float cellSize;
+	bool built;
+	unsigned int tableSize;
+	vector<Entry> entries;     // in insertion order
+	vector<Entry> sorted;      // grouped by bucket
+	vector<int> bucketStart;   // bucket b is sorted[bucketStart[b] .. bucketStart[b + 1])
+	vector<SpriteRef> found;
+};
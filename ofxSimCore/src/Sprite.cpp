@@ -0,0 +1,64 @@
+#include "Sprite.h"
+
+//
+// Basic Sprite Object
+//
+Sprite::Sprite() {
+	speed = 0;
+	velocity = ofVec3f(0, 0, 0);
+	lifespan = -1;      // lifespan of -1 => immortal 
+	birthtime = 0;
+	bSelected = false;
+	haveImage = false;
+	dead = false;
+	name = "sprite";
+	width = 50;
+	height = 50;
+}
+
+// Return a sprite's age in milliseconds at time "now" (ms)
+//
+float Sprite::age(float now) {
+	return (now - birthtime);
+}
+
+//  Set an image for the sprite. If you don't set one, a rectangle
+//  gets drawn.
+//
+void Sprite::setImage(ImageHandle img) {
+	image = img;
+	haveImage = true;
+	width = image->getWidth();
+	height = image->getHeight();
+
+}
+
+//  Where the sprite is drawn, "alpha" of the way between its last two
+//  simulation steps.
+//
+glm::vec3 Sprite::drawPos(float alpha) const {
+	return glm::mix(lastPos, pos, alpha);
+}
+
+//  Render the sprite, "alpha" of the way between its last two
+//  simulation steps.  Drawing never moves the sprite, that all happens
+//  in SpriteSystem::update().
+//
+void Sprite::draw(float alpha) const {
+
+	ofSetColor(255, 255, 255, 255);
+
+	glm::vec3 p = drawPos(alpha);
+
+	// draw image centered and add in translation amount
+	//
+	if (haveImage) {
+		image->draw(-width / 2.0 + p.x, -height / 2.0 + p.y);
+		//cout << "have image" << endl;
+	} else {
+		// in case no image is supplied, draw something.
+		// 
+		ofSetColor(255, 0, 0);
+		ofDrawRectangle(-width / 2.0 + p.x, -height / 2.0, width, height + p.y);
+	}
+}
@@ -0,0 +1,26 @@
+#pragma once
+#include "BaseObject.h"
+#include "ImageCache.h"
+
+class Sprite : public BaseObject {
+public:
+	Sprite();
+	
+	// functions
+	void draw(float alpha = 1.0) const;
+	glm::vec3 drawPos(float alpha) const;
+	float age(float now);   // ms
+	void setImage(ImageHandle);
+
+	// variables
+	float speed;    //   in pixels/sec along heading
+	ofVec3f velocity; // in pixels/sec
+	ImageHandle image;   // shared, see ImageCache
+	float birthtime; // elapsed time in ms
+	float lifespan;  //  time in ms
+	string name;
+	bool haveImage;
+	bool dead;       // removed, waiting for SpriteSystem::compact()
+	float width, height;
+};
+
@@ -0,0 +1,87 @@
+#include "SpriteAtlas.h"
+
+void SpriteAtlas::add(ImageHandle img) {
+	if (img == NULL) return;
+	for (int i = 0; i < images.size(); i++) {
+		if (images[i] == img) return;
+	}
+	images.push_back(img);
+	packed = false;
+}
+
+//  Shelf packing: images go left to right, tallest first, starting a new
+//  row when one doesn't fit.  The atlas is a power of two wide, about
+//  square for the total area, and padded so filtering doesn't bleed
+//  between neighbours.
+//
+bool SpriteAtlas::pack(int padding) {
+	regions.clear();
+	if (images.size() == 0) return false;
+
+	vector<int> order(images.size());
+	int area = 0, widest = 0;
+	for (int i = 0; i < images.size(); i++) {
+		order[i] = i;
+		int w = images[i]->getWidth() + padding;
+		int h = images[i]->getHeight() + padding;
+		area += w * h;
+		widest = std::max(widest, w);
+	}
+	std::sort(order.begin(), order.end(), [this](int a, int b) {
+		return images[a]->getHeight() > images[b]->getHeight();
+	});
+
+	int width = 1;
+	while (width < widest || width * width < area) width <<= 1;
+
+	int x = 0, y = 0, rowHeight = 0;
+	for (int k = 0; k < order.size(); k++) {
+		const ofImage *img = images[order[k]].get();
+		int w = img->getWidth(), h = img->getHeight();
+		if (x + w + padding > width) {
+			x = 0;
+			y += rowHeight;
+			rowHeight = 0;
+		}
+		Region r;
+		r.image = img;
+		r.x = x + padding / 2;
+		r.y = y + padding / 2;
+		r.w = w;
+		r.h = h;
+		regions.push_back(r);
+		x += w + padding;
+		rowHeight = std::max(rowHeight, h + padding);
+	}
+	int height = 1;
+	while (height < y + rowHeight) height <<= 1;
+
+	// copy every image into one RGBA buffer and upload it once
+	//
+	ofPixels pixels;
+	pixels.allocate(width, height, 4);
+	pixels.set(0);
+	for (int i = 0; i < regions.size(); i++) {
+		ofPixels src = regions[i].image->getPixels();
+		src.setImageType(OF_IMAGE_COLOR_ALPHA);
+		src.pasteInto(pixels, regions[i].x, regions[i].y);
+	}
+	atlas.setFromPixels(pixels);
+
+	ofTexture &tex = atlas.getTexture();
+	for (int i = 0; i < regions.size(); i++) {
+		Region &r = regions[i];
+		r.uv0 = tex.getCoordFromPoint(r.x, r.y);
+		r.uv1 = tex.getCoordFromPoint(r.x + r.w, r.y + r.h);
+	}
+
+	packed = true;
+	return true;
+}
+
+const SpriteAtlas::Region *SpriteAtlas::find(const ofImage *img) const {
+	for (int i = 0; i < regions.size(); i++) {
+		if (regions[i].image == img) return &regions[i];
+	}
+	return NULL;
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "ofMain.h"
+#include "ImageCache.h"
+
+//  All the sprite images of a game packed into one texture at load time,
+//  so a SpriteSystem can draw every sprite as one textured mesh instead of
+//  binding a texture per sprite.  add() each image the sprites use, then
+//  pack() once; anything added later needs another pack().
+//
+class SpriteAtlas {
+public:
+	struct Region {
+		const ofImage *image;
+		int x, y, w, h;         // pixels in the atlas
+		glm::vec2 uv0, uv1;     // texture coords of the top left / bottom right corners
+	};
+
+	void add(ImageHandle img);
+	bool pack(int padding = 2);
+	const Region *find(const ofImage *img) const;
+
+	bool isPacked() const { return packed; }
+	ofTexture &getTexture() { return atlas.getTexture(); }
+
+	ofImage atlas;
+	vector<ImageHandle> images;
+	vector<Region> regions;
+
+private:
+	bool packed = false;
+};
@@ -0,0 +1,238 @@
+#include "SpriteSystem.h"
+
+// SpriteSystem class
+SpriteSystem::SpriteSystem(int capacity) {
+	sprites.reserve(capacity);
+
+	// the sprite mesh is refilled every frame
+	//
+	mesh.setUsage(GL_STREAM_DRAW);
+}
+
+//  Hand out the next free slot, reset to a default sprite.  The caller
+//  fills it in place, so nothing is built on the side and copied in.
+//
+Sprite &SpriteSystem::spawn() {
+	if (sprites.size() == sprites.capacity()) {
+		frameAllocs++;
+		totalAllocs++;
+	}
+	frameSpawns++;
+	sprites.emplace_back();
+	return sprites.back();
+}
+
+//  Add a copy of a Sprite to the Sprite System
+//
+void SpriteSystem::add(const Sprite &s) {
+	spawn() = s;
+}
+
+void SpriteSystem::newFrame() {
+	frameSpawns = 0;
+	frameAllocs = 0;
+	frameRetired = 0;
+}
+
+//  Make room for at least n sprites.  Only ever grows.
+//
+void SpriteSystem::reserve(int n) {
+	if (n <= sprites.capacity()) return;
+	sprites.reserve(n);
+	frameAllocs++;
+	totalAllocs++;
+}
+
+// Remove a sprite from the sprite system.  The sprite is only marked dead
+// (a tombstone) so indices stay valid while collisions are being resolved;
+// it is dropped from the vector by the next compact().  Returns false if the
+// sprite was already removed.
+//
+bool SpriteSystem::remove(int i) {
+	if (sprites[i].dead) return false;
+	sprites[i].dead = true;
+	return true;
+}
+
+//  Drop all dead sprites in one pass, sliding the survivors to the front
+//  of the vector and trimming it once.
+//
+void SpriteSystem::compact() {
+	int alive = 0;
+	for (int i = 0; i < sprites.size(); i++) {
+		if (sprites[i].dead) continue;
+		if (alive != i) sprites[alive] = std::move(sprites[i]);
+		alive++;
+	}
+	sprites.resize(alive);
+}
+
+//  Update the SpriteSystem by checking which sprites have exceeded their
+//  lifespan (and deleting).  Also the sprite is moved to it's next
+//  location based on velocity and its speed along its heading.  This is
+//  the only place sprites move.
+//
+void SpriteSystem::update(const SimTime &t) {
+	if (sprites.size() == 0) return;
+
+	// check which sprites have exceed their lifespan and mark them dead,
+	// then compact once.  Erasing inside the loop is O(n^2) when many
+	// expire at once.
+	//
+	for (int i = 0; i < sprites.size(); i++) {
+		if (sprites[i].lifespan != -1 && sprites[i].age(t.time) > sprites[i].lifespan)
+			sprites[i].dead = true;
+		else if (retireOffscreen && leaving(sprites[i])) {
+			sprites[i].dead = true;
+			frameRetired++;
+		}
+	}
+	compact();
+
+	//  Move sprite
+	//
+	for (int i = 0; i < sprites.size(); i++) {
+		sprites[i].saveState();
+		Sprite &s = sprites[i];
+		s.pos += (glm::vec3(s.velocity) + s.heading * s.speed) * t.dt;
+	}
+}
+
+//  Render all the sprites
+//
+void SpriteSystem::draw(float alpha) {
+	frameDrawn = 0;
+	frameCulled = 0;
+
+	if (atlas == NULL || !atlas->isPacked()) {
+		for (int i = 0; i < sprites.size(); i++) {
+			Sprite &s = sprites[i];
+			if (s.dead) continue;
+			if (!onScreen(s, s.drawPos(alpha))) {
+				frameCulled++;
+				continue;
+			}
+			s.draw(alpha);
+			frameDrawn++;
+		}
+		return;
+	}
+
+	// one draw call for everything in the atlas
+	//
+	buildMesh(mesh, alpha);
+	if (mesh.getNumIndices() > 0) {
+		ofSetColor(255, 255, 255, 255);
+		atlas->getTexture().bind();
+		mesh.draw();
+		atlas->getTexture().unbind();
+	}
+
+	for (int k = 0; k < unbatched.size(); k++) {
+		sprites[unbatched[k]].draw(alpha);
+	}
+}
+
+//  Fill a mesh with one textured quad per live, on screen sprite whose image
+//  is in the atlas, sized and placed the way Sprite::draw() places the
+//  image.  Other sprites are listed in "unbatched".  No GL calls.
+//
+void SpriteSystem::buildMesh(ofMesh &m, float alpha) {
+	m.setMode(OF_PRIMITIVE_TRIANGLES);
+
+	vector<glm::vec3> &verts = m.getVertices();
+	vector<glm::vec2> &uvs = m.getTexCoords();
+	vector<ofIndexType> &indices = m.getIndices();
+	verts.clear();
+	uvs.clear();
+	indices.clear();
+	unbatched.clear();
+
+	// sprites from one emitter nearly always share an image, so remember
+	// the last lookup
+	//
+	const ofImage *lastImage = NULL;
+	const SpriteAtlas::Region *region = NULL;
+
+	for (int i = 0; i < sprites.size(); i++) {
+		Sprite &s = sprites[i];
+		if (s.dead) continue;
+
+		glm::vec3 p = s.drawPos(alpha);
+		if (!onScreen(s, p)) {
+			frameCulled++;
+			continue;
+		}
+		frameDrawn++;
+
+		if (!s.haveImage) {
+			unbatched.push_back(i);
+			continue;
+		}
+		if (s.image.get() != lastImage) {
+			lastImage = s.image.get();
+			region = atlas->find(lastImage);
+		}
+		if (region == NULL) {
+			unbatched.push_back(i);
+			continue;
+		}
+
+		float x0 = p.x - s.width / 2.0, y0 = p.y - s.height / 2.0;
+		float x1 = x0 + s.width, y1 = y0 + s.height;
+
+		ofIndexType v = verts.size();
+		verts.push_back(glm::vec3(x0, y0, 0));
+		verts.push_back(glm::vec3(x1, y0, 0));
+		verts.push_back(glm::vec3(x1, y1, 0));
+		verts.push_back(glm::vec3(x0, y1, 0));
+		uvs.push_back(glm::vec2(region->uv0.x, region->uv0.y));
+		uvs.push_back(glm::vec2(region->uv1.x, region->uv0.y));
+		uvs.push_back(glm::vec2(region->uv1.x, region->uv1.y));
+		uvs.push_back(glm::vec2(region->uv0.x, region->uv1.y));
+
+		indices.push_back(v); indices.push_back(v + 1); indices.push_back(v + 2);
+		indices.push_back(v); indices.push_back(v + 2); indices.push_back(v + 3);
+	}
+}
+
+//  True if any of the sprite, drawn centered on p, is inside the bounds.
+//
+bool SpriteSystem::onScreen(const Sprite &s, glm::vec3 p) const {
+	if (bounds.isEmpty()) return true;
+
+	return p.x + s.width / 2.0 >= bounds.getLeft() && p.x - s.width / 2.0 <= bounds.getRight() &&
+		p.y + s.height / 2.0 >= bounds.getTop() && p.y - s.height / 2.0 <= bounds.getBottom();
+}
+
+//  True if the sprite is entirely outside the bounds and its velocity
+//  carries it further out, so it can never be seen again.
+//
+bool SpriteSystem::leaving(const Sprite &s) const {
+	if (bounds.isEmpty()) return false;
+
+	glm::vec3 v = glm::vec3(s.velocity) + s.heading * s.speed;
+	float hw = s.width / 2.0, hh = s.height / 2.0;
+
+	return (s.pos.x + hw < bounds.getLeft() && v.x <= 0) ||
+		(s.pos.x - hw > bounds.getRight() && v.x >= 0) ||
+		(s.pos.y + hh < bounds.getTop() && v.y <= 0) ||
+		(s.pos.y - hh > bounds.getBottom() && v.y >= 0);
+}
+
+// Remove sprites within distance threshold of a point. Like remove(), the
+// sprites are only marked dead until the next compact().
+//
+int SpriteSystem::removeNear(ofVec3f point, float dist) {
+	int count = 0;
+
+	for (int i = 0; i < sprites.size(); i++) {
+		ofVec3f v = sprites[i].pos - point;
+		if (v.length() < dist && remove(i)) {
+			count++;
+		}
+	}
+
+	return count;
+
+}
\ No newline at end of file
@@ -0,0 +1,59 @@
+#pragma once
+#include "ofMain.h"
+#include "Sprite.h"
+#include "SimClock.h"
+#include "SpriteAtlas.h"
+
+//  The sprites live in one vector that is reserved up front and never
+//  shrinks, so once it is big enough spawning and expiry just reuse the
+//  same slots.  The alloc counters count the times it still had to grow.
+//
+class SpriteSystem {
+public:
+	SpriteSystem(int capacity = 512);
+
+	// functions
+	Sprite &spawn();      // default sprite in the next free slot
+	void add(const Sprite &);
+	void reserve(int n);
+	void newFrame();      // call at the top of update() to reset the per frame counters
+	bool remove(int);
+	int removeNear(ofVec3f point, float dist);
+	void compact();
+	void update(const SimTime &t);
+	void draw(float alpha = 1.0);
+	void buildMesh(ofMesh &m, float alpha);
+	void setBounds(const ofRectangle &r) { bounds = r; }
+	bool onScreen(const Sprite &, glm::vec3 p) const;
+	bool leaving(const Sprite &) const;
+
+	// variables
+	vector<Sprite> sprites;
+
+	// when set (and packed), sprites whose image is in the atlas are drawn
+	// as one mesh; the rest still draw one at a time
+	//
+	SpriteAtlas *atlas = NULL;
+	ofVboMesh mesh;
+	vector<int> unbatched;
+
+	// the visible area, usually the window.  Sprites entirely outside it
+	// are not drawn, and with retireOffscreen they are removed once they
+	// are moving away from it, since sprites only move in straight lines
+	// and will never come back.  Empty bounds turn culling off.
+	//
+	ofRectangle bounds;
+	bool retireOffscreen = false;
+
+	// counters
+	//
+	int frameSpawns = 0;
+	int frameAllocs = 0;
+	int totalAllocs = 0;
+	int frameRetired = 0;   // left the bounds, reset by newFrame()
+	int frameDrawn = 0;     // reset by each draw()
+	int frameCulled = 0;
+	//ofSoundPlayer sfx;
+
+};
+
@@ -0,0 +1,106 @@
+#pragma once
+#include "ParticleSystem.h"
+#include <tuple>
+#include <utility>
+
+//  A ParticleSystem whose forces are fixed at compile time.  The forces
+//  are held by value in a tuple instead of a vector of heap allocated
+//  pointers, and update() runs one loop per chunk that sums every force's
+//  at() for a particle, inlined, and writes the force array once instead
+//  of once per force.  Any force type with at(const ParticleBatch &, int)
+//  works, the built-in ones all have it.
+//
+//      StaticParticleSystem<GravityForce, CyclicForce> sys(
+//          GravityForce(ofVec3f(0, -10, 0)), CyclicForce(10));
+//      sys.force<1>().setMagnitude(20);
+//
+//  Everything else (expiry, FIFO mode, the grid, drawing, jobs) is the
+//  ParticleSystem one.  Forces added with addForce() are not applied, and
+//  the integrator is explicit or semi-implicit Euler only; VelocityVerlet
+//  and RK4 run as semi-implicit Euler.
+//
+template <class... Forces>
+class StaticParticleSystem : public ParticleSystem {
+public:
+	StaticParticleSystem(const Forces &... f) : forceSet(f...) {}
+
+	void update(const SimTime &t) override;
+	void reset() override;
+
+	template <size_t I>
+	typename std::tuple_element<I, std::tuple<Forces...> >::type &force() { return std::get<I>(forceSet); }
+
+	std::tuple<Forces...> forceSet;
+
+private:
+	typedef std::index_sequence_for<Forces...> Indices;
+	static const int numForces = sizeof...(Forces);
+
+	void updateFused(int begin, int end, const SimTime &t);
+
+	template <size_t... I>
+	ofVec3f sum(const ParticleBatch &b, int i, const bool *on, std::index_sequence<I...>) {
+		ofVec3f f = b.forces[i];
+		int expand[] = { 0, ((on[I] ? (void)(f += std::get<I>(forceSet).at(b, i)) : (void)0), 0)... };
+		(void)expand;
+		return f;
+	}
+
+	template <size_t... I>
+	void getActive(bool *on, std::index_sequence<I...>) {
+		int expand[] = { 0, (on[I] = !std::get<I>(forceSet).applied, 0)... };
+		(void)expand;
+	}
+
+	template <size_t... I>
+	void setApplied(bool applied, std::index_sequence<I...>) {
+		int expand[] = { 0, ((applied ? (void)(std::get<I>(forceSet).applied = std::get<I>(forceSet).applyOnce) : (void)(std::get<I>(forceSet).applied = false)), 0)... };
+		(void)expand;
+	}
+};
+
+template <class... Forces>
+void StaticParticleSystem<Forces...>::update(const SimTime &t) {
+	grid.invalidate();
+	if (particles.size() == 0) return;
+
+	expire(t);
+	if (particles.size() == 0) return;
+
+	// same chunks and random streams as ParticleSystem::update()
+	//
+	int first = particles.begin();
+	int n = particles.size();
+	if (jobs) {
+		jobs->parallelFor(n, chunkSize, [this, &t, first](int begin, int end) { updateFused(first + begin, first + end, t); });
+	}
+	else {
+		for (int begin = 0; begin < n; begin += chunkSize)
+			updateFused(first + begin, first + std::min(begin + chunkSize, n), t);
+	}
+
+	// one shot forces are spent
+	//
+	setApplied(true, Indices());
+}
+
+template <class... Forces>
+void StaticParticleSystem<Forces...>::reset() {
+	ParticleSystem::reset();
+	setApplied(false, Indices());
+}
+
+//  All the forces for particles [begin, end) in a single pass, then the
+//  same SSE integrate() as ParticleSystem.
+//
+template <class... Forces>
+void StaticParticleSystem<Forces...>::updateFused(int begin, int end, const SimTime &t) {
+	ParticleBatch batch(particles, begin, end, seed * 0x9E3779B97F4A7C15ull + ((uint64_t)t.frame << 32) + begin);
+	bool on[numForces + 1];
+	getActive(on, Indices());
+
+	for (int i = 0; i < batch.count; i++) {
+		batch.forces[i] = sum(batch, i, on, Indices());
+	}
+	integrate(begin, end, t.dt);
+}
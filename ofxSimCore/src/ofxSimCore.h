@@ -0,0 +1,28 @@
+#pragma once
+
+//  ofxSimCore - the particle, sprite and emitter code shared by the
+//  CS134 projects.  Nothing in here depends on ofApp, so it can be
+//  stepped headless (see example-bench).
+//
+#include "BaseObject.h"
+#include "TransformObject.h"
+#include "Particle.h"
+#include "ParticleSystem.h"
+#include "StaticParticleSystem.h"
+#include "ParticleEmitter.h"
+#include "Sprite.h"
+#include "SpriteSystem.h"
+#include "Emitter.h"
+#include "Shape.h"
+#include "SpatialHash.h"
+#include "ImageCache.h"
+#include "SpriteAtlas.h"
+#include "SoundBank.h"
+#include "FixedStep.h"
+#include "FrameProfiler.h"
+#include "JobSystem.h"
+#include "Random.h"
+#include "ParticleGrid.h"
+#include "SimClock.h"
+#include "EmitSchedule.h"
+#include "Integrator.h"
@@ -26,362 +26,6 @@
 //
 //  Caitlyn Chau 
 
-BaseObject::BaseObject() {
-	pos = glm::vec3(0, 0, 0);
-	scaleVector = glm::vec3(1, 1, 1);
-	rot = 0;
-	heading = glm::vec3(0, -1, 0);
-}
-
-void BaseObject::setPosition(glm::vec3 pos) {
-	this->pos = pos;
-}
-
-
-glm::mat4 BaseObject::getMatrix() {
-	glm::mat4 transMatrix = glm::translate(glm::mat4(1.0), glm::vec3(pos));
-	glm::mat4 rotMatrix = glm::rotate(glm::mat4(1.0), glm::radians(rot), glm::vec3(0, 0, 1));
-	glm::mat4 scaleMatrix = glm::scale(glm::mat4(1.0), glm::vec3(this->scaleVector));
-
-	return (transMatrix * rotMatrix * scaleMatrix);
-}
-
-
-//
-// Basic Sprite Object
-//
-Sprite::Sprite() {
-	speed = 0;
-	velocity = ofVec3f(0, 0, 0);
-	lifespan = -1;      // lifespan of -1 => immortal 
-	birthtime = 0;
-	bSelected = false;
-	haveImage = false;
-	name = "Snowflake";
-	width = 50;
-	height = 50;
-}
-
-// Return a sprite's age in milliseconds
-//
-float Sprite::age() {
-	return (ofGetElapsedTimeMillis() - birthtime);
-}
-
-//  Set an image for the sprite. If you don't set one, a rectangle
-//  gets drawn.
-//
-void Sprite::setImage(ofImage img) {
-	image = img;
-	haveImage = true;
-	width = image.getWidth();
-	height = image.getHeight();
-
-}
-
-//  Render the sprite
-//
-void Sprite::draw() {
-
-	ofSetColor(255, 255, 255, 255);
-
-	if (isEnemy) {
-		pos -= 5 * heading;	
-	}
-	else {
-		pos += 7 * heading;
-	}
-
-
-	// draw image centered and add in translation amount
-	//
-	if (haveImage) {
-		image.draw(-width / 2.0 + pos.x, -height / 2.0 + pos.y);
-		//cout << "have image" << endl;
-	}
-	else
-	{
-		// in case no image is supplied, draw something.
-		// 
-		ofSetColor(255, 0, 0);
-		ofDrawRectangle(-width / 2.0 + pos.x, -height / 2.0, width, height + pos.y);
-	}
-
-	//ofPopMatrix();
-}
-
-SpriteSystem::SpriteSystem() {
-	sfx.load("sounds/hit.wav");
-	sfx.setVolume(0.5f);
-}
-
-//  Add a Sprite to the Sprite System
-//
-void SpriteSystem::add(Sprite s) {
-
-	sprites.push_back(s);
-}
-
-// Remove a sprite from the sprite system. Note that this function is not currently
-// used. The typical case is that sprites automatically get removed when the reach
-// their lifespan.
-//
-void SpriteSystem::remove(int i) {
-	sprites.erase(sprites.begin() + i);
-}
-
-//  Update the SpriteSystem by checking which sprites have exceeded their
-//  lifespan (and deleting).  Also the sprite is moved to it's next
-//  location based on velocity and direction.
-//
-void SpriteSystem::update() {
-
-	if (sprites.size() == 0) return;
-	vector<Sprite>::iterator s = sprites.begin();
-	vector<Sprite>::iterator tmp;
-
-	// check which sprites have exceed their lifespan and delete
-	// from list.  When deleting multiple objects from a vector while
-	// traversing at the same time, use an iterator.
-	//
-	while (s != sprites.end()) {
-		if (s->lifespan != -1 && s->age() > s->lifespan) {
-			//			cout << "deleting sprite: " << s->name << endl;
-			tmp = sprites.erase(s);
-			s = tmp;
-		}
-		else s++;
-	}
-
-	//  Move sprite
-	//
-	for (int i = 0; i < sprites.size(); i++) {
-		sprites[i].pos += sprites[i].velocity / ofGetFrameRate();
-	}
-}
-
-//  Render all the sprites
-//
-void SpriteSystem::draw() {
-
-	for (int i = 0; i < sprites.size(); i++) {
-		sprites[i].draw();
-	}
-}
-
-
-
-int SpriteSystem::removeNear(ofVec3f point, float dist) {
-	vector<Sprite>::iterator s = sprites.begin();
-	vector<Sprite>::iterator tmp;
-	int count = 0;
-
-	while (s != sprites.end()) {
-		ofVec3f v = s->pos - point;
-		if (v.length() < dist) {
-			tmp = sprites.erase(s);
-			count++;
-			s = tmp;
-		}
-		else s++;
-	}
-
-	if (count > 0) {
-		sfx.play();
-	}
-	return count;
-
-}
-
-//  Create a new Emitter - needs a SpriteSystem
-//
-Emitter::Emitter(SpriteSystem *spriteSys) {
-	sys = spriteSys;
-	lifespan = 3000;    // milliseconds
-	started = false;
-	lastSpawned = 0;
-	rate = 1;    // sprites/sec
-	haveChildImage = false;
-	haveImage = false;
-	velocity = ofVec3f(100, 100, 0);
-	drawable = true;
-	width = 100;
-	height = 100;
-	childWidth = 100;
-	childHeight = 100;
-}
-
-//  Draw the Emitter if it is drawable. In many cases you would want a hidden emitter
-//
-//
-void Emitter::draw() {
-
-	ofPushMatrix();
-	ofMultMatrix(getMatrix());
-
-	if (drawable) {
-		if (haveImage) {
-			image.draw(-image.getWidth() / 2.0, -image.getHeight() / 2.0);
-		}
-		else {
-			ofSetColor(0, 0, 200);
-			ofDrawRectangle(-width / 2.0, -height / 2.0, width, height);
-		}
-	}
-	ofPopMatrix();
-
-	sys->draw();
-
-}
-
-//  Update the Emitter. If it has been started, spawn new sprites with
-//  initial velocity, lifespan, birthtime.
-//
-void Emitter::update() {
-	if (!started) return;
-
-	float time = ofGetElapsedTimeMillis();
-	if (started) {
-		if ((time - lastSpawned) > (1000.0 / rate)) {
-			shoot(time);
-		}
-	}
-
-	if (isEnemy && type == LinearEnemy) {
-		if (left && pos.x >= 0) {
-			move(MoveLeft, 3);
-		}
-		else if (left && pos.x < 0) {
-			left = false;
-		} 
-		else if (!left && pos.x > ofGetWindowWidth()) {
-			left = true;
-		}
-		else if (!left && pos.x <= ofGetWindowWidth()) {
-			move(MoveRight, 3);
-		}
-	}
-
-	if (isEnemy && type == CircularEnemy) {
-		move(MoveCircle, 4);
-	}
-
-	if (isEnemy && type == SineEnemy) {
-		if (left && pos.x >= 0) {
-			move(MoveSine, 3);
-			pos.x--;
-		}
-		else if (left && pos.x < 0) {
-			left = false;
-		}
-		else if (!left && pos.x > ofGetWindowWidth()) {
-			left = true;
-		}
-		else if (!left && pos.x <= ofGetWindowWidth()) {
-			move(MoveSine, 3);
-			pos.x++;
-		}
-	}
-
-
-
-	sys->update();
-}
-
-// Shoot one sprite
-void Emitter::shoot(float time) {
-	shootSound.load("sounds/shoot.wav");
-	shootSound.setVolume(0.06f);
-	if (!isEnemy) {
-		shootSound.play();
-	}
-
-	// spawn a new sprite
-	Sprite sprite;
-	if (haveChildImage) {
-		sprite.setImage(childImage);
-	}
-	sprite.velocity = velocity;
-	sprite.lifespan = lifespan;
-	sprite.heading = heading;
-	sprite.setPosition(pos);
-	sprite.birthtime = time;
-	sprite.isEnemy = isEnemy;
-	sys->add(sprite);
-	lastSpawned = time;
-	//cout << "velocity = " << sprite.velocity << endl;
-}
-
-
-// Move the Emitter based off a direction: Stop, Left, Right, Up, Down
-void Emitter::move(MoveDir direction, int speed) {
-	switch (direction) {
-	case MoveStop:
-		break;
-	case MoveLeft:
-		pos.x -= speed;
-		break;
-	case MoveRight:
-		pos.x += speed;
-		break;
-	case MoveUp:
-		pos.y -= speed;
-		break;
-	case MoveDown:
-		pos.y += speed;
-		break;
-	case MoveCircle:
-		pos.x += glm::cos(glm::radians(rot)) * speed;
-		pos.y += glm::sin(glm::radians(rot)) * speed;
-		rot++;
-		break;
-	case MoveSine:
-		pos.y += glm::sin(glm::radians(rot)) * speed;
-		rot++;
-	default:
-		break;
-	}
-}
-
-// Start/Stop the emitter.
-//
-void Emitter::start() {
-	started = true;
-	lastSpawned = ofGetElapsedTimeMillis();
-}
-
-void Emitter::stop() {
-	started = false;
-}
-
-void Emitter::setLifespan(float life) {
-	lifespan = life;
-}
-
-void Emitter::setVelocity(ofVec3f v) {
-	velocity = v;
-}
-
-void Emitter::setChildImage(ofImage img) {
-	childImage = img;
-	haveChildImage = true;
-	childWidth = img.getWidth();
-	childHeight = img.getHeight();
-}
-
-void Emitter::setImage(ofImage img) {
-	image = img;
-	haveImage = true;
-	width = img.getWidth();
-	height = img.getHeight();
-}
-
-void Emitter::setRate(float r) {
-	rate = r;
-}
-
-
-
 //--------------------------------------------------------------
 void ofApp::setup() {
 
@@ -391,7 +35,8 @@ void ofApp::setup() {
 
 	// create an image for sprites being spawned by emitter
 	//
-	if (gunSpriteImage.load("images/blue_heart.png")) {
+	gunSpriteImage = ImageCache::load("images/blue_heart.png");
+	if (gunSpriteImage) {
 		spriteImageLoaded = true;
 	}
 	else {
@@ -400,7 +45,8 @@ void ofApp::setup() {
 	}
 
 	// load image for gun
-	if (gunImage.load("images/penguin.png")) {
+	gunImage = ImageCache::load("images/penguin.png");
+	if (gunImage) {
 		turretImageLoaded = true;
 	}
 	else {
@@ -409,7 +55,8 @@ void ofApp::setup() {
 	}
 
 	// load image for enemy
-	if (enemyImage.load("images/cat.png")) {
+	enemyImage = ImageCache::load("images/cat.png");
+	if (enemyImage) {
 		enemyImageLoaded = true;
 	}
 	else {
@@ -418,7 +65,8 @@ void ofApp::setup() {
 	}
 
 	// load image for enemy sprite
-	if (enemySpriteImage.load("images/poop.png")) {
+	enemySpriteImage = ImageCache::load("images/poop.png");
+	if (enemySpriteImage) {
 		enemySpriteImageLoaded = true;
 	}
 	else {
@@ -426,6 +74,13 @@ void ofApp::setup() {
 		ofExit();
 	}
 
+	// pack the sprite images into one texture so each SpriteSystem
+	// draws all of its sprites in a single call
+	//
+	atlas.add(gunSpriteImage);
+	atlas.add(enemySpriteImage);
+	atlas.pack();
+
 	gui.setup();
 	gui.add(enemyRateSlider.setup("enemy rate", 0.5, 0.1, 2));
 	gui.add(lifeSlider.setup("life", 5, .1, 10));
@@ -486,6 +141,17 @@ void ofApp::setup() {
 	gun->drawable = true;
 	gun->setImage(gunImage);
 	gun->setChildImage(gunSpriteImage);
+	gun->sounds = &sounds;
+
+	// shots that have left the window are dropped rather than living
+	// out their full lifespan
+	//
+	gun->sys->atlas = &atlas;
+	gun->sys->retireOffscreen = true;
+	for (int i = 0; i < enemies.size(); i++) {
+		enemies[i]->sys->atlas = &atlas;
+		enemies[i]->sys->retireOffscreen = true;
+	}
 
 
 	bHide = false;
@@ -496,6 +162,11 @@ void ofApp::setup() {
 
 	text.load("8bitfont.ttf", 20);
 
+	// shots are loaded once here with a few voices so they can overlap
+	//
+	sounds.load("shoot", "sounds/shoot.wav", 8, 0.06f);
+	sounds.load("hit", "sounds/hit.wav", 4, 0.5f);
+
 	musicPlayer.load("sounds/background-music.wav");
 	musicPlayer.setVolume(0.1f);
 	
@@ -506,11 +177,32 @@ void ofApp::setup() {
 
 //--------------------------------------------------------------
 void ofApp::update() {
+	sounds.newFrame();
+	ofRectangle view(0, 0, ofGetWindowWidth(), ofGetWindowHeight());
+	gun->sys->newFrame();
+	gun->sys->setBounds(view);
+	for (int i = 0; i < enemies.size(); i++) {
+		enemies[i]->sys->newFrame();
+		enemies[i]->sys->setBounds(view);
+	}
+
+	// run the simulation in fixed steps, however long the last frame
+	// actually took, so the sprites and gun move the same at any frame rate
+	//
+	int steps = clock.advance(ofGetLastFrameTime());
+	for (int i = 0; i < steps; i++) {
+		step(simClock.tick(clock.dt));
+	}
+}
+
+//  Advance the whole game by one fixed simulation step
+//
+void ofApp::step(const SimTime &t) {
 	//gun->heading = heading();
 	gun->setRate(gunRateSlider);
 	gun->setLifespan(lifeSlider * 1000);    // convert to milliseconds 
 	gun->setVelocity(ofVec3f(0, -100, 0));
-	gun->update();
+	gun->update(t);
 
 	// update enemies
 	for (int i = 0; i < enemies.size(); i++) {
@@ -518,7 +210,7 @@ void ofApp::update() {
 		enemy->setRate(enemyRateSlider);
 		enemy->setLifespan(lifeSlider * 1000);  // convert to milliseconds 
 		enemy->setVelocity(ofVec3f(velocity->x, velocity->y, velocity->z));
-		enemy->update();
+		enemy->update(t);
 	}
 
 	checkCollisions();
@@ -527,8 +219,8 @@ void ofApp::update() {
 	// emitters.  We are computing in milleseconds so we need
 	// to multiply seconds by 1000 to convert to ms.
 	//
-	float t = ofGetElapsedTimeMillis();
-	if ((t - gameStartTime > (50 * 1000))) {
+	float now = ofGetElapsedTimeMillis();
+	if ((now - gameStartTime > (50 * 1000))) {
 		gameOver = true;
 		gameStarted = false;
 		gun->stop();
@@ -548,16 +240,23 @@ void ofApp::update() {
 
 //--------------------------------------------------------------
 void ofApp::draw() {
-	background.resize(ofGetWindowWidth(), ofGetWindowHeight());
-	background.draw(0, 0);
+	// scale the sky on the GPU, resizing the image itself every frame
+	// resamples it on the CPU and uploads it again
+	//
+	background.draw(0, 0, ofGetWindowWidth(), ofGetWindowHeight());
 
 	if (gameStarted) {
+
+		// draw between the last two simulation steps
+		//
+		float alpha = clock.alpha();
+
 		gun->heading = heading();
-		gun->draw();
+		gun->draw(alpha);
 		//ofDrawLine(gun->pos, gun->pos + 150 * heading());
 
 		for (int i = 0; i < enemies.size(); i++) {
-			enemies[i]->draw();
+			enemies[i]->draw(alpha);
 		}
 
 		// draw current score
@@ -576,6 +275,14 @@ void ofApp::draw() {
 
 	if (!bHide) {
 		gui.draw();
+
+		// sound counters for this frame
+		//
+		string soundText;
+		soundText += "sound loads: " + std::to_string(sounds.frameLoads);
+		soundText += "  plays: " + std::to_string(sounds.framePlays);
+		soundText += "  steals: " + std::to_string(sounds.steals);
+		ofDrawBitmapString(soundText, ofPoint(10, ofGetWindowHeight() - 10));
 	}
 }
 
@@ -590,25 +297,29 @@ void ofApp::checkCollisions() {
 	// number of missiles removed.
 	//
 	for (int i = 0; i < gun->sys->sprites.size(); i++) {
-	
-
-		glm::vec3 shot = gun->sys->sprites[i].pos;
+		if (gun->sys->sprites[i].dead) continue;
 
-		//cout << "shot pos = " << shot << endl;
 		for (int j = 0; j < enemies.size(); j++) {
 
 			int spritesHit = enemies[j]->sys->removeNear(gun->sys->sprites[i].pos, collisionDist);
-			score += spritesHit;
 			
 			if (spritesHit > 0) {
 				gun->sys->remove(i); // remove the gun's sprite
 				score += spritesHit;
+				sounds.play("hit");
 				break;
 			}
 			
 		}
 
 	}
+
+	// removed sprites are only marked dead above; drop them now
+	//
+	gun->sys->compact();
+	for (int j = 0; j < enemies.size(); j++) {
+		enemies[j]->sys->compact();
+	}
 }
 
 
@@ -2,97 +2,10 @@
 
 #include "ofMain.h"
 #include "ofxGui.h"
-
-typedef enum { MoveStop, MoveLeft, MoveRight, MoveUp, MoveDown, MoveCircle, MoveSine} MoveDir;
-typedef enum { LinearEnemy, CircularEnemy, SineEnemy} EnemyType;
-
-// This is a base object that all drawable object inherit from
-// It is possible this will be replaced by ofNode when we move to 3D
-// 
-class BaseObject {
-public:
-	BaseObject();
-	glm::vec3 scaleVector;
-	float rot;
-	bool bSelected;
-	glm::vec3 pos; //added
-	glm::vec3 heading;
-	void setPosition(glm::vec3);
-	glm::mat4 getMatrix();
-	bool isEnemy = false;
-};
-
-//  General Sprite class  (similar to a Particle)
-//
-class Sprite : public BaseObject {
-public:
-	Sprite();
-	void draw();
-	float age();
-	void setImage(ofImage);
-	float speed;    //   in pixels/sec
-	ofVec3f velocity; // in pixels/sec
-	ofImage image;
-	float birthtime; // elapsed time in ms
-	float lifespan;  //  time in ms
-	string name;
-	bool haveImage;
-	float width, height;
-};
-
-//  Manages all Sprites in a system.  You can create multiple systems
-//
-class SpriteSystem {
-public:
-	SpriteSystem();
-	void add(Sprite);
-	void remove(int);
-	int removeNear(ofVec3f point, float dist);
-	void update();
-	void draw();
-	vector<Sprite> sprites;
-	ofSoundPlayer sfx;
-
-
-};
-
-
-//  General purpose Emitter class for emitting sprites
-//  This works similar to a Particle emitter
-//
-class Emitter : public BaseObject {
-public:
-	Emitter(SpriteSystem *);
-	void draw();
-	void start();
-	void stop();
-	void setLifespan(float);
-	void setVelocity(ofVec3f);
-	void setChildImage(ofImage);
-	void setChildSize(float w, float h) { childWidth = w; childHeight = h; }
-	void setImage(ofImage);
-	void setRate(float);
-	void update();
-	void shoot(float time);
-	void move(MoveDir type, int speed);
-
-	SpriteSystem *sys;
-	float rate;
-	ofVec3f velocity;
-	float lifespan;
-	bool started;
-	float lastSpawned;
-	ofImage childImage;
-	ofImage image;
-	bool drawable;
-	bool haveChildImage;
-	bool haveImage;
-	float width, height;
-	float childWidth, childHeight;
-	ofSoundPlayer shootSound;
-	bool left;
-	EnemyType type;
-};
+#include "Emitter.h"
+#include "ImageCache.h"
+#include "SoundBank.h"
+#include "FixedStep.h"
 
 
 class ofApp : public ofBaseApp {
@@ -100,6 +13,7 @@ class ofApp : public ofBaseApp {
 public:
 	void setup();
 	void update();
+	void step(const SimTime &t);
 	void draw();
 
 	void keyPressed(int key);
@@ -119,10 +33,11 @@ public:
 	vector<Emitter *> enemies;
 	int numLinearEnemies;
 
-	ofImage gunSpriteImage; // gun sprite
-	ofImage gunImage; // gun
-	ofImage enemyImage;  // enemy
-	ofImage enemySpriteImage; 
+	ImageHandle gunSpriteImage; // gun sprite
+	ImageHandle gunImage; // gun
+	ImageHandle enemyImage;  // enemy
+	ImageHandle enemySpriteImage; 
+	SpriteAtlas atlas;     // sprite images packed for batched drawing
 
 
 	bool spriteImageLoaded; 
@@ -134,6 +49,12 @@ public:
 
 	ofImage background;
 	ofSoundPlayer musicPlayer;
+	SoundBank sounds;
+
+	// simulation clock, 60 fixed steps per second, and the virtual time
+	// handed to each step
+	FixedStep clock;
+	SimClock simClock = SimClock(true);
 	ofTrueTypeFont text;
 
 	ofxFloatSlider enemyRateSlider; 
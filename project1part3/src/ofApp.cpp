@@ -29,7 +29,8 @@ void ofApp::setup() {
 
 	// create an image for sprites being spawned by emitter
 	//
-	if (gunSpriteImage.load("images/blue_heart.png")) {
+	gunSpriteImage = ImageCache::load("images/blue_heart.png");
+	if (gunSpriteImage) {
 		spriteImageLoaded = true;
 	}
 	else {
@@ -38,7 +39,8 @@ void ofApp::setup() {
 	}
 
 	// load image for penguin
-	if (gunImage.load("images/penguin.png")) {
+	gunImage = ImageCache::load("images/penguin.png");
+	if (gunImage) {
 		turretImageLoaded = true;
 	}
 	else {
@@ -47,7 +49,8 @@ void ofApp::setup() {
 	}
 
 	// load image for enemy
-	if (enemyImage.load("images/cat.png")) {
+	enemyImage = ImageCache::load("images/cat.png");
+	if (enemyImage) {
 		enemyImageLoaded = true;
 	}
 	else {
@@ -56,7 +59,8 @@ void ofApp::setup() {
 	}
 
 	// load image for enemy sprite
-	if (enemySpriteImage.load("images/poop.png")) {
+	enemySpriteImage = ImageCache::load("images/poop.png");
+	if (enemySpriteImage) {
 		enemySpriteImageLoaded = true;
 	}
 	else {
@@ -64,6 +68,13 @@ void ofApp::setup() {
 		ofExit();
 	}
 
+	// pack the sprite images into one texture so each SpriteSystem
+	// draws all of its sprites in a single call
+	//
+	atlas.add(gunSpriteImage);
+	atlas.add(enemySpriteImage);
+	atlas.pack();
+
 	gui.setup();
 	//gui.add(enemyRateSlider.setup("enemy rate", 0.5, 0.1, 2));
 	gui.add(lifeSlider.setup("life", 5, .1, 10));
@@ -124,6 +135,17 @@ void ofApp::setup() {
 	penguin->drawable = true;
 	penguin->setImage(gunImage);
 	penguin->setChildImage(gunSpriteImage);
+	penguin->sounds = &sounds;
+
+	// shots that have left the window are dropped rather than living
+	// out their full lifespan
+	//
+	penguin->sys->atlas = &atlas;
+	penguin->sys->retireOffscreen = true;
+	for (int i = 0; i < enemies.size(); i++) {
+		enemies[i]->sys->atlas = &atlas;
+		enemies[i]->sys->retireOffscreen = true;
+	}
 	thrustForce = new ThrustForce(thrustSlider);
 
 
@@ -135,6 +157,8 @@ void ofApp::setup() {
 	pEmitter->setVelocity(ofVec3f(50, 50, 0));
 	pEmitter->setParticleRadius(2);
 	pEmitter->setGroupSize(15);
+	pEmitter->setFifo(true);
+	pEmitter->setMaxBursts(16);    // explosions that can overlap within a lifespan
 
 	bHide = false;
 	gameStarted = false;
@@ -151,9 +175,11 @@ void ofApp::setup() {
 	musicPlayer.setMultiPlay(true);
 	musicPlayer.setVolume(0.1f);
 
-	sfx.load("sounds/hit.wav");
-	sfx.setMultiPlay(true);
-	sfx.setVolume(0.5f);
+	// sound effects are loaded once here, with a few voices each
+	// so overlapping shots and hits don't cut each other off
+	//
+	sounds.load("shoot", "sounds/shoot.wav", 8, 0.06f);
+	sounds.load("hit", "sounds/hit.wav", 4, 0.5f);
 
 	musicPlayer.play();
 	musicPlayer.setLoop(true);
@@ -162,12 +188,36 @@ void ofApp::setup() {
 
 //--------------------------------------------------------------
 void ofApp::update() {
+	profiler.frame();
+	profiler.begin("update");
+	sounds.newFrame();
+	ofRectangle view(0, 0, ofGetWindowWidth(), ofGetWindowHeight());
+	penguin->sys->newFrame();
+	penguin->sys->setBounds(view);
+	for (int i = 0; i < enemies.size(); i++) {
+		enemies[i]->sys->newFrame();
+		enemies[i]->sys->setBounds(view);
+	}
+
+	// run the simulation in fixed steps on one clock, however
+	// long the last frame actually took
+	//
+	int steps = clock.advance(ofGetLastFrameTime());
+	for (int i = 0; i < steps; i++) {
+		step(simClock.tick(clock.dt));
+	}
+	profiler.end("update");
+}
+
+//  Advance the whole game by one fixed simulation step
+//
+void ofApp::step(const SimTime &t) {
 	//penguin->heading = heading();
 	penguin->setRate(gunRateSlider);
 	penguin->setLifespan(lifeSlider * 1000);    // convert to milliseconds 
 	//penguin->setVelocity(ofVec3f(0, -100, 0));
-	penguin->update();
-	penguin->integrate();
+	penguin->update(t);
+	penguin->integrate(t.dt);
 
 	// update enemies
 	for (int i = 0; i < enemies.size(); i++) {
@@ -175,17 +225,26 @@ void ofApp::update() {
 		enemy->setRate(ofRandom(0.1, 2));
 		enemy->setLifespan(lifeSlider * 1000);  // convert to milliseconds 
 		//enemy->setVelocity(ofVec3f(velocity->x, velocity->y, velocity->z));
-		enemy->update();
+		enemy->update(t);
 	}
 
 	// update particle emitter
-	pEmitter->update();
+	pEmitter->update(t);
 
+	profiler.begin("collisions");
 	checkCollisions();
+	profiler.end("collisions");
+
+	// drop everything removed during collisions in one pass
+	//
+	penguin->sys->compact();
+	for (int i = 0; i < enemies.size(); i++) {
+		enemies[i]->sys->compact();
+	}
 
 	// game runs for 120 seconds OR while lives > 0
-	float t = ofGetElapsedTimeMillis();
-	if ((t - gameStartTime > (120 * 1000)) || penguinLives <= 0) {
+	float now = ofGetElapsedTimeMillis();
+	if ((now - gameStartTime > (120 * 1000)) || penguinLives <= 0) {
 		gameOver = true;
 		gameStarted = false;
 		penguin->stop();
@@ -196,18 +255,29 @@ void ofApp::update() {
 
 //--------------------------------------------------------------
 void ofApp::draw() {
-	background.resize(ofGetWindowWidth(), ofGetWindowHeight());
-	background.draw(0, 0);
+	profiler.begin("draw");
+
+	// scale the sky on the GPU as it's drawn rather than resampling the
+	// image on the CPU (and uploading it again) every frame
+	//
+	profiler.begin("background");
+	background.draw(0, 0, ofGetWindowWidth(), ofGetWindowHeight());
+	profiler.end("background");
 
 	pEmitter->draw();
 
 	if (gameStarted) {
+
+		// draw between the last two simulation steps
+		//
+		float alpha = clock.alpha();
+
 		penguin->heading = heading();
-		penguin->draw();
+		penguin->draw(alpha);
 		//ofDrawLine(penguin->pos, penguin->pos + 150 * heading());
 
 		for (int i = 0; i < enemies.size(); i++) {
-			enemies[i]->draw();
+			enemies[i]->draw(alpha);
 		}
 
 		// draw current score text
@@ -229,9 +299,54 @@ void ofApp::draw() {
 	else {
 		openingText.drawString("PRESS SPACE TO START", 325, ofGetWindowHeight() / 2);
 	}
+	profiler.end("draw");
 
 	if (!bHide) {
 		gui.draw();
+		profiler.draw(ofGetWindowWidth() - 560, 20);
+
+		// sound counters for this frame
+		//
+		string soundStr;
+		soundStr += "sound loads: " + std::to_string(sounds.frameLoads);
+		soundStr += "  plays: " + std::to_string(sounds.framePlays);
+		soundStr += "  steals: " + std::to_string(sounds.steals);
+		ofSetColor(ofColor::white);
+		ofDrawBitmapString(soundStr, 10, ofGetWindowHeight() - 10);
+
+		// sprite spawns and vector growth for this frame, allocs
+		// should stay at 0 once the game is running
+		//
+		int spawns = penguin->sys->frameSpawns;
+		int allocs = penguin->sys->frameAllocs;
+		int totalAllocs = penguin->sys->totalAllocs;
+		for (int i = 0; i < enemies.size(); i++) {
+			spawns += enemies[i]->sys->frameSpawns;
+			allocs += enemies[i]->sys->frameAllocs;
+			totalAllocs += enemies[i]->sys->totalAllocs;
+		}
+		string spriteStr;
+		spriteStr += "sprite spawns: " + std::to_string(spawns);
+		spriteStr += "  allocs: " + std::to_string(allocs);
+		spriteStr += "  total allocs: " + std::to_string(totalAllocs);
+		ofDrawBitmapString(spriteStr, 10, ofGetWindowHeight() - 25);
+
+		// how many sprites were drawn and skipped as off screen this
+		// frame, and how many left the window and were retired
+		//
+		int drawn = penguin->sys->frameDrawn;
+		int culled = penguin->sys->frameCulled;
+		int retired = penguin->sys->frameRetired;
+		for (int i = 0; i < enemies.size(); i++) {
+			drawn += enemies[i]->sys->frameDrawn;
+			culled += enemies[i]->sys->frameCulled;
+			retired += enemies[i]->sys->frameRetired;
+		}
+		string cullStr;
+		cullStr += "sprites drawn: " + std::to_string(drawn);
+		cullStr += "  culled: " + std::to_string(culled);
+		cullStr += "  retired: " + std::to_string(retired);
+		ofDrawBitmapString(cullStr, 10, ofGetWindowHeight() - 40);
 	}
 }
 
@@ -247,47 +362,58 @@ void ofApp::checkCollisions() {
 	//
 	float collisionDist = penguin->childHeight / 2 + enemies[0]->childHeight / 2;
 
-	// Loop through all the missiles, then remove any invaders that are within
-	// "collisionDist" of the missiles.  the removeNear() function returns the
-	// number of missiles removed.
+	// bucket all the enemy sprites into the grid so each test below only
+	// looks at sprites in the neighbouring cells
 	//
-	for (int i = 0; i < penguin->sys->sprites.size(); i++) {
-
-		glm::vec3 shot = penguin->sys->sprites[i].pos;
-
-		//cout << "shot pos = " << shot << endl;
-		for (int j = 0; j < enemies.size(); j++) {
-
-			int spritesHit = enemies[j]->sys->removeNear(shot, collisionDist);
+	grid.setCellSize(collisionDist);
+	grid.clear();
+	for (int j = 0; j < enemies.size(); j++) {
+		grid.insert(enemies[j]->sys);
+	}
 
-			score += spritesHit;
+	// find every missile that is within "collisionDist" of an invader.
+	// Sprites are only marked dead here so the indices from the grid
+	// stay valid; they are compacted at the end of the frame.
+	//
+	grid.pairs(penguin->sys, collisionDist, hits);
+	for (int i = 0; i < hits.size(); i++) {
+		SpriteRef shot = hits[i].a;
+		SpriteRef target = hits[i].b;
+
+		// a missile is spent on its first hit, and skip invaders another
+		// missile already took out
+		//
+		if (penguin->sys->sprites[shot.index].dead) continue;
+		if (!target.sys->remove(target.index)) continue;
+		score++;
+
+		penguin->sys->remove(shot.index);
+		explode(penguin->sys->sprites[shot.index].pos);
+		sounds.play("hit");
+	}
 
-			if (spritesHit > 0) {
-				explode(shot);
-				sfx.play();
-				penguin->sys->remove(i); // remove the penguin's sprit
-				break;
-			}
+	// are any poops near penguin.  lose lives once for each enemy that hit it
+	//
+	grid.query(penguin->pos, collisionDist, nearby);
+	for (int j = 0; j < enemies.size(); j++) {
+		bool hit = false;
+		for (int i = 0; i < nearby.size(); i++) {
+			if (nearby[i].sys == enemies[j]->sys && nearby[i].sys->remove(nearby[i].index))
+				hit = true;
 		}
+		if (hit) penguinLives -= 7;
 	}
 
-	// are any poops near penguin
-	for (int i = 0; i < enemies.size(); i++) {
-
-		glm::vec3 shot = penguin->pos;
-
-		//cout << "shot pos = " << shot << endl;
-		for (int j = 0; j < enemies[i]->sys->sprites.size(); j++) {
-
-			int spritesHit = enemies[i]->sys->removeNear(shot, collisionDist);
-
-			if (spritesHit > 0) {			
-				penguinLives -= 7;
-				break;
-			}
-
+	// explosion debris takes out any invader it touches
+	//
+	float debrisDist = enemies[0]->childHeight / 2;
+	for (int j = 0; j < enemies.size(); j++) {
+		SpriteSystem *sys = enemies[j]->sys;
+		for (int i = 0; i < sys->sprites.size(); i++) {
+			if (sys->sprites[i].dead) continue;
+			pEmitter->sys->queryRadius(sys->sprites[i].pos, debrisDist, debris);
+			if (debris.size() > 0 && sys->remove(i)) score++;
 		}
-
 	}
 }
 
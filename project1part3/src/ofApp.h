@@ -4,6 +4,11 @@
 #include "ofxGui.h"
 #include "Emitter.h"
 #include "ParticleEmitter.h"
+#include "SpatialHash.h"
+#include "SoundBank.h"
+#include "FixedStep.h"
+#include "SimClock.h"
+#include "FrameProfiler.h"
 
 class Force {
 protected:
@@ -28,6 +33,7 @@ class ofApp : public ofBaseApp{
 public:
 	void setup();
 	void update();
+	void step(const SimTime &t);
 	void draw();
 
 	void keyPressed(int key);
@@ -46,10 +52,11 @@ public:
 	vector<Emitter *> enemies;
 	int numLinearEnemies;
 
-	ofImage gunSpriteImage; // penguin sprite
-	ofImage gunImage; // penguin
-	ofImage enemyImage;  // enemy
-	ofImage enemySpriteImage;
+	ImageHandle gunSpriteImage; // penguin sprite
+	ImageHandle gunImage; // penguin
+	ImageHandle enemyImage;  // enemy
+	ImageHandle enemySpriteImage;
+	SpriteAtlas atlas;     // sprite images packed for batched drawing
 
 
 	bool spriteImageLoaded;
@@ -62,7 +69,7 @@ public:
 	ofImage background;
 
 	ofSoundPlayer musicPlayer;
-	ofSoundPlayer sfx;
+	SoundBank sounds;
 
 	ofTrueTypeFont openingText;
 	ofTrueTypeFont scoreText;
@@ -83,6 +90,16 @@ public:
 	int penguinLives;
 	float gameStartTime;
 
+	// simulation clock, 60 fixed steps per second
+	FixedStep clock;
+
+	// time handed to each step.  Virtual, so ages and spawn times only
+	// move by the steps actually run.
+	SimClock simClock = SimClock(true);
+
+	// frame time per section, shown with the GUI
+	FrameProfiler profiler;
+
 	// forces
 	ThrustForce *thrustForce;
 
@@ -97,4 +114,8 @@ public:
 	void checkCollisions();
 	void explode(glm::vec3 p);
 	ParticleEmitter *pEmitter = NULL;
+	SpatialHash grid;
+	vector<SpritePair> hits;
+	vector<SpriteRef> nearby;
+	vector<int> debris;
 };